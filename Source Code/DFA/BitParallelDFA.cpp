@@ -0,0 +1,185 @@
+// BitParallelDFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "BitParallelDFA.h"
+
+const int BitParallelDFA::MAXIMUM_POSITIONS_COUNT = 64;
+
+BitParallelDFA::BitParallelDFA(const CompiledDFA * compiledDFA)
+{
+	this->compiledDFA = compiledDFA;
+	this->groupsCount = 0;
+	this->positionsCount = 0;
+	this->symbolGroups.assign(CompiledDFA::SYMBOLS_COUNT,CompiledDFA::ERROR_STATE_INDEX);
+}
+
+// Checks if every reachable state reaches some final state, so that a dead run always ends in the error state
+bool BitParallelDFA::areAllStatesUseful() const
+{
+	int statesCount = this->compiledDFA->getStatesCount(), classesCount = this->compiledDFA->getClassesCount();
+	const int * table = this->compiledDFA->getTransitionTable();
+	vector<bool> reachable(statesCount,false), useful(statesCount,false);
+	vector< vector<int> > predecessors(statesCount);
+	vector<int> pendingStates;
+	reachable[this->compiledDFA->getInitialState()] = true;
+	pendingStates.push_back(this->compiledDFA->getInitialState());
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		for(int symbolClass = 0; symbolClass < classesCount; symbolClass++)
+		{
+			int destination = table[pendingStates[index] * classesCount + symbolClass];
+			if(destination != CompiledDFA::ERROR_STATE_INDEX)
+			{
+				predecessors[destination].push_back(pendingStates[index]);
+				if(!reachable[destination])
+				{
+					reachable[destination] = true;
+					pendingStates.push_back(destination);
+				}
+			}
+		}
+	}
+	pendingStates.clear();
+	for(int state = 0; state < statesCount; state++)
+	{
+		if(reachable[state] && this->compiledDFA->isFinal(state))
+		{
+			useful[state] = true;
+			pendingStates.push_back(state);
+		}
+	}
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		for(int predecessor = 0; predecessor < predecessors[pendingStates[index]].size(); predecessor++)
+		{
+			int state = predecessors[pendingStates[index]][predecessor];
+			if(!useful[state])
+			{
+				useful[state] = true;
+				pendingStates.push_back(state);
+			}
+		}
+	}
+	for(int state = 0; state < statesCount; state++)
+	{
+		if(reachable[state] && !useful[state])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Lays out every accepted word starting with symbols[0] in the group, fails when the group outgrows a 64 bit word
+bool BitParallelDFA::addWords(int group, int state, vector<unsigned char> & symbols, vector<int> & states)
+{
+	if(this->compiledDFA->isFinal(state))
+	{
+		if(this->positionsCount + symbols.size() > BitParallelDFA::MAXIMUM_POSITIONS_COUNT)
+		{
+			return false;
+		}
+		for(int index = 0; index < symbols.size(); index++)
+		{
+			uint64_t position = (uint64_t)1 << (this->positionsCount + index);
+			this->positionStates[group * BitParallelDFA::MAXIMUM_POSITIONS_COUNT + this->positionsCount + index] = states[index];
+			if(index == 0)
+			{
+				this->startMasks[group] |= position;
+			}
+			else
+			{
+				this->symbolMasks[group * CompiledDFA::SYMBOLS_COUNT + symbols[index]] |= position;
+			}
+		}
+		this->positionsCount += symbols.size();
+	}
+	for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+	{
+		int destination = this->compiledDFA->getNextState(state,(char)symbol);
+		if(destination != CompiledDFA::ERROR_STATE_INDEX)
+		{
+			symbols.push_back((unsigned char)symbol);
+			states.push_back(destination);
+			if(!this->addWords(group,destination,symbols,states))
+			{
+				return false;
+			}
+			symbols.pop_back();
+			states.pop_back();
+		}
+	}
+	return true;
+}
+
+// Returns NULL when the DFA accepts an infinite language, has dead states or its words do not fit the groups
+BitParallelDFA * BitParallelDFA::compile(const CompiledDFA * compiledDFA)
+{
+	BitParallelDFA * bitParallelDFA;
+	int initialState = compiledDFA->getInitialState();
+	if(initialState == CompiledDFA::ERROR_STATE_INDEX || compiledDFA->getMaximumLength() > BitParallelDFA::MAXIMUM_POSITIONS_COUNT)
+	{
+		return NULL;
+	}
+	bitParallelDFA = new BitParallelDFA(compiledDFA);
+	if(!bitParallelDFA->areAllStatesUseful())
+	{
+		delete bitParallelDFA;
+		return NULL;
+	}
+	for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+	{
+		int destination = compiledDFA->getNextState(initialState,(char)symbol);
+		if(destination != CompiledDFA::ERROR_STATE_INDEX)
+		{
+			vector<unsigned char> symbols(1,(unsigned char)symbol);
+			vector<int> states(1,destination);
+			int group = bitParallelDFA->groupsCount++;
+			bitParallelDFA->symbolGroups[symbol] = group;
+			bitParallelDFA->startMasks.push_back(0);
+			bitParallelDFA->symbolMasks.resize(bitParallelDFA->groupsCount * CompiledDFA::SYMBOLS_COUNT,0);
+			bitParallelDFA->positionStates.resize(bitParallelDFA->groupsCount * BitParallelDFA::MAXIMUM_POSITIONS_COUNT,CompiledDFA::ERROR_STATE_INDEX);
+			bitParallelDFA->positionsCount = 0;
+			if(!bitParallelDFA->addWords(group,destination,symbols,states))
+			{
+				delete bitParallelDFA;
+				return NULL;
+			}
+		}
+	}
+	return bitParallelDFA;
+}
+
+int BitParallelDFA::getGroupsCount() const
+{
+	return this->groupsCount;
+}
+
+// Every set bit of the mask stands for a prefix of some word equal to the input read so far, so all of them share one state
+int BitParallelDFA::run(const char * input, size_t length) const
+{
+	int group;
+	uint64_t mask;
+	const uint64_t * symbolMasks;
+	if(length == 0)
+	{
+		return this->compiledDFA->getInitialState();
+	}
+	group = this->symbolGroups[(unsigned char)input[0]];
+	if(group == CompiledDFA::ERROR_STATE_INDEX)
+	{
+		return CompiledDFA::ERROR_STATE_INDEX;
+	}
+	mask = this->startMasks[group];
+	symbolMasks = this->symbolMasks.data() + group * CompiledDFA::SYMBOLS_COUNT;
+	for(size_t index = 1; index < length; index++)
+	{
+		mask = (mask << 1) & symbolMasks[(unsigned char)input[index]];
+		if(mask == 0)
+		{
+			return CompiledDFA::ERROR_STATE_INDEX;
+		}
+	}
+	return this->positionStates[group * BitParallelDFA::MAXIMUM_POSITIONS_COUNT + __builtin_ctzll(mask)];
+}
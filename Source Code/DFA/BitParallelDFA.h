@@ -0,0 +1,35 @@
+// BitParallelDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __bit_parallel_dfa__
+#define __bit_parallel_dfa__
+
+#include "CompiledDFA.h"
+
+using namespace std;
+
+// Anchored Shift-And over the words accepted by a small finite DFA (a keywords trie, for instance)
+// Words are grouped by their first symbol so each group fits in a single 64 bit word, one bit per word position
+class BitParallelDFA
+{
+	private:
+		const CompiledDFA * compiledDFA;
+		int groupsCount;
+		int positionsCount;
+		vector<int> symbolGroups;
+		vector<uint64_t> startMasks;
+		vector<uint64_t> symbolMasks;
+		vector<int> positionStates;
+		BitParallelDFA(const CompiledDFA * compiledDFA);
+		bool areAllStatesUseful() const;
+		bool addWords(int group, int state, vector<unsigned char> & symbols, vector<int> & states);
+
+	public:
+		static const int MAXIMUM_POSITIONS_COUNT;
+		static BitParallelDFA * compile(const CompiledDFA * compiledDFA);
+		int getGroupsCount() const;
+		int run(const char * input, size_t length) const;
+};
+
+#endif
@@ -0,0 +1,147 @@
+// CombinedDFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "CombinedDFA.h"
+
+const int CombinedDFA::NO_RECOGNIZER = -1;
+
+void initializeCombinedDFAValidationResult(CombinedDFAValidationResult & combinedDFAValidationResult)
+{
+	combinedDFAValidationResult.valid = false;
+	combinedDFAValidationResult.recognizer = CombinedDFA::NO_RECOGNIZER;
+	combinedDFAValidationResult.tag = State::NO_TAG;
+	combinedDFAValidationResult.currentState = NULL;
+}
+
+CombinedDFA::CombinedDFA(const vector<DFA *> & dfas)
+{
+	vector<CompiledDFA *> compiledDFAs;
+	vector< vector<int> > pendingStates;
+	map<vector<int>,int> indexes;
+	vector<int> initialTuple;
+	this->statesCount = 0;
+	this->initialState = CompiledDFA::ERROR_STATE_INDEX;
+	for(int index = 0; index < dfas.size(); index++)
+	{
+		compiledDFAs.push_back(dfas[index]->getCompiledDFA());
+		initialTuple.push_back(compiledDFAs[index]->getInitialState());
+	}
+	indexes[initialTuple] = this->statesCount++;
+	pendingStates.push_back(initialTuple);
+	this->initialState = 0;
+	for(int stateIndex = 0; stateIndex < pendingStates.size(); stateIndex++)
+	{
+		vector<int> currentTuple = pendingStates[stateIndex];
+		int recognizer = CombinedDFA::NO_RECOGNIZER;
+		for(int index = 0; index < compiledDFAs.size(); index++)
+		{
+			if(compiledDFAs[index]->isFinal(currentTuple[index]))
+			{
+				recognizer = index;
+				break;
+			}
+		}
+		this->recognizers.push_back(recognizer);
+		this->tags.push_back((recognizer != CombinedDFA::NO_RECOGNIZER) ? compiledDFAs[recognizer]->getTag(currentTuple[recognizer]) : State::NO_TAG);
+		this->acceptingStates.push_back((recognizer != CombinedDFA::NO_RECOGNIZER) ? compiledDFAs[recognizer]->getState(currentTuple[recognizer]) : (State *)State::ERROR_STATE);
+		for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+		{
+			vector<int> nextTuple(currentTuple.size(),CompiledDFA::ERROR_STATE_INDEX);
+			bool dead = true;
+			for(int index = 0; index < compiledDFAs.size(); index++)
+			{
+				if(currentTuple[index] != CompiledDFA::ERROR_STATE_INDEX)
+				{
+					nextTuple[index] = compiledDFAs[index]->getNextState(currentTuple[index],(char)symbol);
+					if(nextTuple[index] != CompiledDFA::ERROR_STATE_INDEX)
+					{
+						dead = false;
+					}
+				}
+			}
+			if(dead)
+			{
+				this->transitionTable.push_back(CompiledDFA::ERROR_STATE_INDEX);
+			}
+			else
+			{
+				map<vector<int>,int>::iterator found = indexes.find(nextTuple);
+				if(found == indexes.end())
+				{
+					indexes[nextTuple] = this->statesCount;
+					pendingStates.push_back(nextTuple);
+					this->transitionTable.push_back(this->statesCount++);
+				}
+				else
+				{
+					this->transitionTable.push_back(found->second);
+				}
+			}
+		}
+	}
+	this->classesCount = CompiledDFA::compressSymbols(this->transitionTable,this->statesCount,this->symbolClasses);
+}
+
+CombinedDFA::~CombinedDFA()
+{
+	this->clear();
+}
+
+int CombinedDFA::getStatesCount() const
+{
+	return this->statesCount;
+}
+
+int CombinedDFA::getClassesCount() const
+{
+	return this->classesCount;
+}
+
+CombinedDFAValidationResult CombinedDFA::validate(const char * input, size_t length) const
+{
+	CombinedDFAValidationResult result;
+	int currentState = this->initialState;
+	const int * table = this->transitionTable.data();
+	const unsigned char * classes = this->symbolClasses.data();
+	initializeCombinedDFAValidationResult(result);
+	for(size_t index = 0; index < length && currentState != CompiledDFA::ERROR_STATE_INDEX; index++)
+	{
+		currentState = table[currentState * this->classesCount + classes[(unsigned char)input[index]]];
+	}
+	if(currentState != CompiledDFA::ERROR_STATE_INDEX && this->recognizers[currentState] != CombinedDFA::NO_RECOGNIZER)
+	{
+		result.valid = true;
+		result.recognizer = this->recognizers[currentState];
+		result.tag = this->tags[currentState];
+		result.currentState = this->acceptingStates[currentState];
+	}
+	return result;
+}
+
+CombinedDFAValidationResult CombinedDFA::validate(string_view input) const
+{
+	return this->validate(input.data(),input.length());
+}
+
+void CombinedDFA::saveStaticModel(ofstream & headerFile, const string & tableName)
+{
+	CompiledDFA::writeStaticTable(headerFile,tableName,this->statesCount,this->initialState,this->classesCount,this->symbolClasses.data(),this->transitionTable.data(),this->recognizers,this->tags);
+}
+
+void CombinedDFA::saveDirectCodedModel(ofstream & headerFile, const string & scannerName)
+{
+	CompiledDFA::writeDirectCodedScanner(headerFile,scannerName,this->statesCount,this->initialState,this->classesCount,this->symbolClasses.data(),this->transitionTable.data(),this->recognizers,this->tags);
+}
+
+void CombinedDFA::clear()
+{
+	this->statesCount = 0;
+	this->initialState = CompiledDFA::ERROR_STATE_INDEX;
+	this->classesCount = 0;
+	this->symbolClasses.clear();
+	this->transitionTable.clear();
+	this->recognizers.clear();
+	this->tags.clear();
+	this->acceptingStates.clear();
+}
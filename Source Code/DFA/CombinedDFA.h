@@ -0,0 +1,48 @@
+// CombinedDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __combined_dfa__
+#define __combined_dfa__
+
+#include "DFA.h"
+
+using namespace std;
+
+typedef struct CombinedDFAValidationResult
+{
+	bool valid;
+	int recognizer;
+	int tag;
+	State * currentState;
+}
+CombinedDFAValidationResult;
+
+void initializeCombinedDFAValidationResult(CombinedDFAValidationResult & combinedDFAValidationResult);
+
+class CombinedDFA
+{
+	private:
+		int statesCount;
+		int initialState;
+		int classesCount;
+		vector<unsigned char> symbolClasses;
+		vector<int> transitionTable;
+		vector<int> recognizers;
+		vector<int> tags;
+		vector<State *> acceptingStates;
+
+	public:
+		static const int NO_RECOGNIZER;
+		CombinedDFA(const vector<DFA *> & dfas);
+		~CombinedDFA();
+		int getStatesCount() const;
+		int getClassesCount() const;
+		CombinedDFAValidationResult validate(const char * input, size_t length) const;
+		CombinedDFAValidationResult validate(string_view input) const;
+		void saveStaticModel(ofstream & headerFile, const string & tableName);
+		void saveDirectCodedModel(ofstream & headerFile, const string & scannerName);
+		void clear();
+};
+
+#endif
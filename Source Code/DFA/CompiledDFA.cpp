@@ -0,0 +1,678 @@
+// CompiledDFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "CompiledDFA.h"
+
+const int CompiledDFA::SYMBOLS_COUNT = 256;
+const int CompiledDFA::ERROR_STATE_INDEX = -1;
+const size_t CompiledDFA::PARALLEL_MINIMUM_CHUNK_LENGTH = 1 << 16;
+const int CompiledDFA::PARALLEL_MAXIMUM_STATES_COUNT = 256;
+const int CompiledDFA::ENUMERATION_MERGE_INTERVAL = 16;
+const size_t CompiledDFA::UNBOUNDED_LENGTH = SIZE_MAX;
+
+CompiledDFA::CompiledDFA(vector<State *> states)
+{
+	map<State *,int> indexes;
+	this->statesCount = states.size();
+	this->initialState = CompiledDFA::ERROR_STATE_INDEX;
+	this->states = move(states);
+	this->mappedMemory = NULL;
+	this->mappedSize = 0;
+	this->transitionTable.assign(this->statesCount * CompiledDFA::SYMBOLS_COUNT,CompiledDFA::ERROR_STATE_INDEX);
+	this->finalStates.assign(this->statesCount,false);
+	this->stateTags.assign(this->statesCount,State::NO_TAG);
+	for(int index = 0; index < this->statesCount; index++)
+	{
+		indexes[this->states[index]] = index;
+		this->states[index]->setId(index);
+	}
+	for(int index = 0; index < this->statesCount; index++)
+	{
+		State * currentState = this->states[index];
+		const vector<Transition *> & transitions = currentState->getTransitions();
+		if(currentState->isInitial() && this->initialState == CompiledDFA::ERROR_STATE_INDEX)
+		{
+			this->initialState = index;
+		}
+		this->finalStates[index] = currentState->isFinal();
+		this->stateTags[index] = currentState->getTag();
+		for(int transitionIndex = 0; transitionIndex < transitions.size(); transitionIndex++)
+		{
+			Transition * currentTransition = transitions[transitionIndex];
+			if(currentTransition->getDestination() != State::ERROR_STATE)
+			{
+				int destination = indexes[currentTransition->getDestination()];
+				const SymbolSet & symbols = currentTransition->getSymbolSet();
+				for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+				{
+					if(symbols.test(symbol))
+					{
+						this->transitionTable[index * CompiledDFA::SYMBOLS_COUNT + symbol] = destination;
+					}
+				}
+			}
+		}
+	}
+	this->classesCount = CompiledDFA::compressSymbols(this->transitionTable,this->statesCount,this->symbolClasses);
+	this->classes = this->symbolClasses.data();
+	this->table = this->transitionTable.data();
+	this->finals = this->finalStates.data();
+	this->tags = this->stateTags.data();
+	this->computePrefilters();
+}
+
+CompiledDFA::CompiledDFA(int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const unsigned char * finalStates, const int * stateTags, vector<State *> states, void * mappedMemory, size_t mappedSize)
+{
+	this->statesCount = statesCount;
+	this->initialState = initialState;
+	this->classesCount = classesCount;
+	this->classes = symbolClasses;
+	this->table = transitionTable;
+	this->finals = finalStates;
+	this->tags = stateTags;
+	this->states = move(states);
+	this->mappedMemory = mappedMemory;
+	this->mappedSize = mappedSize;
+	for(int index = 0; index < this->states.size(); index++)
+	{
+		this->states[index]->setId(index);
+	}
+	this->computePrefilters();
+}
+
+// Checks if some input without symbols of avoidedClass is accepted (no class is avoided when passing classesCount)
+bool CompiledDFA::isAccepting(int avoidedClass) const
+{
+	vector<bool> visited(this->statesCount,false);
+	vector<int> pendingStates;
+	if(this->initialState != CompiledDFA::ERROR_STATE_INDEX)
+	{
+		visited[this->initialState] = true;
+		pendingStates.push_back(this->initialState);
+	}
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		if(this->finals[pendingStates[index]])
+		{
+			return true;
+		}
+		for(int symbolClass = 0; symbolClass < this->classesCount; symbolClass++)
+		{
+			int destination = this->table[pendingStates[index] * this->classesCount + symbolClass];
+			if(symbolClass != avoidedClass && destination != CompiledDFA::ERROR_STATE_INDEX && !visited[destination])
+			{
+				visited[destination] = true;
+				pendingStates.push_back(destination);
+			}
+		}
+	}
+	return false;
+}
+
+// Computes the cheap rejection data checked by mayAccept: valid first symbols, accepted lengths and required symbols
+void CompiledDFA::computePrefilters()
+{
+	vector<bool> reachable(this->statesCount,false), useful(this->statesCount,false);
+	vector<int> pendingStates, distances(this->statesCount,-1), incomingCount(this->statesCount,0), longestDistances(this->statesCount,0);
+	vector< vector<int> > predecessors(this->statesCount);
+	vector<int> classSizes(this->classesCount,0);
+	int processedCount = 0, usefulCount = 0;
+	this->firstSymbols.reset();
+	this->requiredSymbols.reset();
+	this->requiredSymbolsList.clear();
+	this->minimumLength = CompiledDFA::UNBOUNDED_LENGTH;
+	this->maximumLength = 0;
+	if(this->initialState == CompiledDFA::ERROR_STATE_INDEX)
+	{
+		return;
+	}
+	for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+	{
+		classSizes[this->classes[symbol]]++;
+		if(this->table[this->initialState * this->classesCount + this->classes[symbol]] != CompiledDFA::ERROR_STATE_INDEX)
+		{
+			this->firstSymbols.set(symbol);
+		}
+	}
+
+	// Shortest accepted length (breadth first search from the initial state)
+	distances[this->initialState] = 0;
+	pendingStates.push_back(this->initialState);
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		int state = pendingStates[index];
+		reachable[state] = true;
+		if(this->finals[state] && this->minimumLength == CompiledDFA::UNBOUNDED_LENGTH)
+		{
+			this->minimumLength = distances[state];
+		}
+		for(int symbolClass = 0; symbolClass < this->classesCount; symbolClass++)
+		{
+			int destination = this->table[state * this->classesCount + symbolClass];
+			if(destination != CompiledDFA::ERROR_STATE_INDEX)
+			{
+				predecessors[destination].push_back(state);
+				if(distances[destination] == -1)
+				{
+					distances[destination] = distances[state] + 1;
+					pendingStates.push_back(destination);
+				}
+			}
+		}
+	}
+
+	// Longest accepted length, bounded only if no cycle lies on a path from the initial state to a final one
+	pendingStates.clear();
+	for(int state = 0; state < this->statesCount; state++)
+	{
+		if(reachable[state] && this->finals[state])
+		{
+			useful[state] = true;
+			pendingStates.push_back(state);
+		}
+	}
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		for(int predecessor = 0; predecessor < predecessors[pendingStates[index]].size(); predecessor++)
+		{
+			int source = predecessors[pendingStates[index]][predecessor];
+			if(!useful[source])
+			{
+				useful[source] = true;
+				pendingStates.push_back(source);
+			}
+		}
+	}
+	for(int state = 0; state < this->statesCount; state++)
+	{
+		if(useful[state])
+		{
+			usefulCount++;
+			for(int symbolClass = 0; symbolClass < this->classesCount; symbolClass++)
+			{
+				int destination = this->table[state * this->classesCount + symbolClass];
+				if(destination != CompiledDFA::ERROR_STATE_INDEX && useful[destination])
+				{
+					incomingCount[destination]++;
+				}
+			}
+		}
+	}
+	pendingStates.clear();
+	if(useful[this->initialState] && incomingCount[this->initialState] == 0)
+	{
+		pendingStates.push_back(this->initialState);
+	}
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		int state = pendingStates[index];
+		processedCount++;
+		if(this->finals[state])
+		{
+			this->maximumLength = max(this->maximumLength,(size_t)longestDistances[state]);
+		}
+		for(int symbolClass = 0; symbolClass < this->classesCount; symbolClass++)
+		{
+			int destination = this->table[state * this->classesCount + symbolClass];
+			if(destination != CompiledDFA::ERROR_STATE_INDEX && useful[destination])
+			{
+				longestDistances[destination] = max(longestDistances[destination],longestDistances[state] + 1);
+				if(--incomingCount[destination] == 0)
+				{
+					pendingStates.push_back(destination);
+				}
+			}
+		}
+	}
+	if(processedCount != usefulCount)
+	{
+		this->maximumLength = CompiledDFA::UNBOUNDED_LENGTH;
+	}
+
+	// Required symbols, only classes made of a single symbol are kept so that the check is a plain search
+	if(this->minimumLength != CompiledDFA::UNBOUNDED_LENGTH)
+	{
+		for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+		{
+			if(classSizes[this->classes[symbol]] == 1 && !this->isAccepting(this->classes[symbol]))
+			{
+				this->requiredSymbols.set(symbol);
+				this->requiredSymbolsList.push_back(symbol);
+			}
+		}
+	}
+}
+
+// Simulates a chunk from every state at once (enumerative simulation), stateMap gets the state each start state ends at
+// Lanes that reach the same state are merged from time to time, as most automata converge after a few symbols
+void CompiledDFA::enumerateChunk(const char * input, size_t length, vector<int> & stateMap) const
+{
+	vector<int> lanes(this->statesCount), laneOfState(this->statesCount), laneOfCurrentState(this->statesCount);
+	vector<int> mergedLanes;
+	const int * table = this->table;
+	const unsigned char * classes = this->classes;
+	int classesCount = this->classesCount;
+	for(int state = 0; state < this->statesCount; state++)
+	{
+		lanes[state] = state;
+		laneOfState[state] = state;
+	}
+	for(size_t index = 0; index < length && !lanes.empty(); index++)
+	{
+		const int * column = table + classes[(unsigned char)input[index]];
+		int lanesCount = lanes.size();
+		int * currentLanes = lanes.data();
+		for(int lane = 0; lane < lanesCount; lane++)
+		{
+			if(currentLanes[lane] != CompiledDFA::ERROR_STATE_INDEX)
+			{
+				currentLanes[lane] = column[currentLanes[lane] * classesCount];
+			}
+		}
+		if(index % CompiledDFA::ENUMERATION_MERGE_INTERVAL == CompiledDFA::ENUMERATION_MERGE_INTERVAL - 1 || index == length - 1)
+		{
+			vector<int> laneRemap(lanesCount,CompiledDFA::ERROR_STATE_INDEX);
+			mergedLanes.clear();
+			laneOfCurrentState.assign(this->statesCount,CompiledDFA::ERROR_STATE_INDEX);
+			for(int lane = 0; lane < lanesCount; lane++)
+			{
+				int state = lanes[lane];
+				if(state != CompiledDFA::ERROR_STATE_INDEX)
+				{
+					if(laneOfCurrentState[state] == CompiledDFA::ERROR_STATE_INDEX)
+					{
+						laneOfCurrentState[state] = mergedLanes.size();
+						mergedLanes.push_back(state);
+					}
+					laneRemap[lane] = laneOfCurrentState[state];
+				}
+			}
+			for(int state = 0; state < this->statesCount; state++)
+			{
+				if(laneOfState[state] != CompiledDFA::ERROR_STATE_INDEX)
+				{
+					laneOfState[state] = laneRemap[laneOfState[state]];
+				}
+			}
+			lanes.swap(mergedLanes);
+		}
+	}
+	stateMap.assign(this->statesCount,CompiledDFA::ERROR_STATE_INDEX);
+	for(int state = 0; state < this->statesCount; state++)
+	{
+		if(laneOfState[state] != CompiledDFA::ERROR_STATE_INDEX && !lanes.empty())
+		{
+			stateMap[state] = lanes[laneOfState[state]];
+		}
+	}
+}
+
+CompiledDFA::~CompiledDFA()
+{
+	this->clear();
+}
+
+int CompiledDFA::compressSymbols(vector<int> & transitionTable, int statesCount, vector<unsigned char> & symbolClasses)
+{
+	map<vector<int>,int> classes;
+	vector<int> compressedTable;
+	symbolClasses.assign(CompiledDFA::SYMBOLS_COUNT,0);
+	for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+	{
+		vector<int> column(statesCount);
+		for(int state = 0; state < statesCount; state++)
+		{
+			column[state] = transitionTable[state * CompiledDFA::SYMBOLS_COUNT + symbol];
+		}
+		map<vector<int>,int>::iterator found = classes.find(column);
+		if(found == classes.end())
+		{
+			int newClass = classes.size();
+			classes[column] = newClass;
+			symbolClasses[symbol] = newClass;
+		}
+		else
+		{
+			symbolClasses[symbol] = found->second;
+		}
+	}
+	compressedTable.assign(statesCount * classes.size(),CompiledDFA::ERROR_STATE_INDEX);
+	for(int state = 0; state < statesCount; state++)
+	{
+		for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+		{
+			compressedTable[state * classes.size() + symbolClasses[symbol]] = transitionTable[state * CompiledDFA::SYMBOLS_COUNT + symbol];
+		}
+	}
+	transitionTable.swap(compressedTable);
+	return classes.size();
+}
+
+void CompiledDFA::writeStaticTable(ofstream & headerFile, const string & tableName, int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const vector<int> & recognizers, const vector<int> & finalStateTags)
+{
+	headerFile << "struct " << tableName << endl << "{" << endl;
+	headerFile << "\tstatic constexpr int STATES_COUNT = " << statesCount << ";" << endl;
+	headerFile << "\tstatic constexpr int CLASSES_COUNT = " << classesCount << ";" << endl;
+	headerFile << "\tstatic constexpr int INITIAL_STATE = " << initialState << ";" << endl;
+	headerFile << "\tstatic constexpr unsigned char SYMBOL_CLASSES[" << CompiledDFA::SYMBOLS_COUNT << "] = {";
+	for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+	{
+		headerFile << ((symbol > 0) ? "," : "") << (int)symbolClasses[symbol];
+	}
+	headerFile << "};" << endl;
+	headerFile << "\tstatic constexpr int TRANSITION_TABLE[" << statesCount * classesCount << "] = {" << endl;
+	for(int state = 0; state < statesCount; state++)
+	{
+		headerFile << "\t\t";
+		for(int symbolClass = 0; symbolClass < classesCount; symbolClass++)
+		{
+			headerFile << transitionTable[state * classesCount + symbolClass] << ((state < statesCount - 1 || symbolClass < classesCount - 1) ? "," : "");
+		}
+		headerFile << endl;
+	}
+	headerFile << "\t};" << endl;
+	headerFile << "\tstatic constexpr int RECOGNIZERS[" << statesCount << "] = {";
+	for(int state = 0; state < statesCount; state++)
+	{
+		headerFile << ((state > 0) ? "," : "") << recognizers[state];
+	}
+	headerFile << "};" << endl;
+	headerFile << "\tstatic constexpr int FINAL_STATE_TAGS[" << statesCount << "] = {";
+	for(int state = 0; state < statesCount; state++)
+	{
+		headerFile << ((state > 0) ? "," : "") << finalStateTags[state];
+	}
+	headerFile << "};" << endl;
+	headerFile << "};" << endl << endl;
+}
+
+// Writes a direct-coded (re2c like) scanner, every state becomes a label and a switch on the next symbol
+void CompiledDFA::writeDirectCodedScanner(ofstream & headerFile, const string & scannerName, int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const vector<int> & recognizers, const vector<int> & finalStateTags)
+{
+	vector<bool> targeted(statesCount,false);
+	for(int index = 0; index < statesCount * classesCount; index++)
+	{
+		if(transitionTable[index] != CompiledDFA::ERROR_STATE_INDEX)
+		{
+			targeted[transitionTable[index]] = true;
+		}
+	}
+	headerFile << "struct " << scannerName << endl << "{" << endl;
+	headerFile << "\tstatic constexpr int STATES_COUNT = " << statesCount << ";" << endl;
+	headerFile << "\tstatic constexpr int RECOGNIZERS[" << statesCount << "] = {";
+	for(int state = 0; state < statesCount; state++)
+	{
+		headerFile << ((state > 0) ? "," : "") << recognizers[state];
+	}
+	headerFile << "};" << endl;
+	headerFile << "\tstatic constexpr int FINAL_STATE_TAGS[" << statesCount << "] = {";
+	for(int state = 0; state < statesCount; state++)
+	{
+		headerFile << ((state > 0) ? "," : "") << finalStateTags[state];
+	}
+	headerFile << "};" << endl << endl;
+	headerFile << "\tstatic int run(const char * input, size_t length)" << endl << "\t{" << endl;
+	headerFile << "\t\tconst char * cursor = input, * end = input + length;" << endl;
+	if(initialState == CompiledDFA::ERROR_STATE_INDEX)
+	{
+		headerFile << "\t\treturn " << CompiledDFA::ERROR_STATE_INDEX << ";" << endl;
+	}
+	else
+	{
+		headerFile << "\t\tgoto state_" << initialState << ";" << endl;
+		for(int state = 0; state < statesCount; state++)
+		{
+			map<int,vector<int> > symbolsByDestination;
+			if(!targeted[state] && state != initialState)
+			{
+				continue;
+			}
+			for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+			{
+				int destination = transitionTable[state * classesCount + symbolClasses[symbol]];
+				if(destination != CompiledDFA::ERROR_STATE_INDEX)
+				{
+					symbolsByDestination[destination].push_back(symbol);
+				}
+			}
+			headerFile << "\tstate_" << state << ":" << endl;
+			headerFile << "\t\tif(cursor == end)" << endl << "\t\t{" << endl << "\t\t\treturn " << state << ";" << endl << "\t\t}" << endl;
+			headerFile << "\t\tswitch((unsigned char)*cursor++)" << endl << "\t\t{" << endl;
+			for(map<int,vector<int> >::iterator iterator = symbolsByDestination.begin(); iterator != symbolsByDestination.end(); iterator++)
+			{
+				headerFile << "\t\t\t";
+				for(int index = 0; index < iterator->second.size(); index++)
+				{
+					headerFile << "case " << iterator->second[index] << ": ";
+				}
+				headerFile << endl << "\t\t\t\tgoto state_" << iterator->first << ";" << endl;
+			}
+			headerFile << "\t\t\tdefault:" << endl << "\t\t\t\treturn " << CompiledDFA::ERROR_STATE_INDEX << ";" << endl;
+			headerFile << "\t\t}" << endl;
+		}
+	}
+	headerFile << "\t}" << endl;
+	headerFile << "};" << endl << endl;
+}
+
+int CompiledDFA::getStatesCount() const
+{
+	return this->statesCount;
+}
+
+int CompiledDFA::getClassesCount() const
+{
+	return this->classesCount;
+}
+
+int CompiledDFA::getInitialState() const
+{
+	return this->initialState;
+}
+
+const unsigned char * CompiledDFA::getSymbolClasses() const
+{
+	return this->classes;
+}
+
+const int * CompiledDFA::getTransitionTable() const
+{
+	return this->table;
+}
+
+const unsigned char * CompiledDFA::getFinalStates() const
+{
+	return this->finals;
+}
+
+const int * CompiledDFA::getStateTags() const
+{
+	return this->tags;
+}
+
+int CompiledDFA::getNextState(int state, char symbol) const
+{
+	return this->table[state * this->classesCount + this->classes[(unsigned char)symbol]];
+}
+
+bool CompiledDFA::isFinal(int state) const
+{
+	return state != CompiledDFA::ERROR_STATE_INDEX && this->finals[state];
+}
+
+int CompiledDFA::getTag(int state) const
+{
+	return ((state != CompiledDFA::ERROR_STATE_INDEX) ? this->tags[state] : State::NO_TAG);
+}
+
+State * CompiledDFA::getState(int state) const
+{
+	return ((state != CompiledDFA::ERROR_STATE_INDEX) ? this->states[state] : (State *)State::ERROR_STATE);
+}
+
+int CompiledDFA::run(int state, const char * input, size_t length) const
+{
+	int currentState = state;
+	const int * table = this->table;
+	const unsigned char * classes = this->classes;
+	for(size_t index = 0; index < length && currentState != CompiledDFA::ERROR_STATE_INDEX; index++)
+	{
+		currentState = table[currentState * this->classesCount + classes[(unsigned char)input[index]]];
+	}
+	return currentState;
+}
+
+int CompiledDFA::run(const char * input, size_t length) const
+{
+	return this->run(this->initialState,input,length);
+}
+
+int CompiledDFA::run(const string & input) const
+{
+	return this->run(input.data(),input.length());
+}
+
+void CompiledDFA::runBatch(const string_view * inputs, int * states, size_t count) const
+{
+	for(size_t index = 0; index < count; index++)
+	{
+		states[index] = this->run(this->initialState,inputs[index].data(),inputs[index].length());
+	}
+}
+
+int CompiledDFA::runParallel(const char * input, size_t length, int threadsCount) const
+{
+	vector<thread> threads;
+	vector< vector<int> > stateMaps;
+	size_t chunkLength;
+	int currentState;
+	if(threadsCount <= 0)
+	{
+		threadsCount = thread::hardware_concurrency();
+	}
+	threadsCount = min((size_t)max(threadsCount,1),length / CompiledDFA::PARALLEL_MINIMUM_CHUNK_LENGTH);
+
+	// Small inputs or big automata are not worth the enumeration
+	if(threadsCount <= 1 || this->statesCount > CompiledDFA::PARALLEL_MAXIMUM_STATES_COUNT)
+	{
+		return this->run(input,length);
+	}
+	chunkLength = length / threadsCount;
+	stateMaps.resize(threadsCount);
+	threads.reserve(threadsCount - 1);
+
+	// Threads already started are joined if starting another one fails, as destroying a joinable thread terminates
+	try
+	{
+		for(int chunk = 1; chunk < threadsCount; chunk++)
+		{
+			size_t currentChunkLength = ((chunk < threadsCount - 1) ? chunkLength : length - chunk * chunkLength);
+			threads.push_back(thread(&CompiledDFA::enumerateChunk,this,input + chunk * chunkLength,currentChunkLength,ref(stateMaps[chunk])));
+		}
+	}
+	catch(...)
+	{
+		for(int index = 0; index < threads.size(); index++)
+		{
+			threads[index].join();
+		}
+		throw;
+	}
+	currentState = this->run(input,chunkLength);
+	for(int index = 0; index < threads.size(); index++)
+	{
+		threads[index].join();
+	}
+	for(int chunk = 1; chunk < threadsCount && currentState != CompiledDFA::ERROR_STATE_INDEX; chunk++)
+	{
+		currentState = stateMaps[chunk][currentState];
+	}
+	return currentState;
+}
+
+int CompiledDFA::longestMatch(const char * begin, const char * end, size_t & length) const
+{
+	int currentState = this->initialState, acceptingState = CompiledDFA::ERROR_STATE_INDEX;
+	const int * table = this->table;
+	const unsigned char * classes = this->classes;
+	length = 0;
+	for(const char * cursor = begin; currentState != CompiledDFA::ERROR_STATE_INDEX; cursor++)
+	{
+		if(this->finals[currentState])
+		{
+			acceptingState = currentState;
+			length = cursor - begin;
+		}
+		if(cursor == end)
+		{
+			break;
+		}
+		currentState = table[currentState * this->classesCount + classes[(unsigned char)*cursor]];
+	}
+	return acceptingState;
+}
+
+const SymbolSet & CompiledDFA::getFirstSymbols() const
+{
+	return this->firstSymbols;
+}
+
+const SymbolSet & CompiledDFA::getRequiredSymbols() const
+{
+	return this->requiredSymbols;
+}
+
+size_t CompiledDFA::getMinimumLength() const
+{
+	return this->minimumLength;
+}
+
+size_t CompiledDFA::getMaximumLength() const
+{
+	return this->maximumLength;
+}
+
+// Rejects inputs that can not be accepted without running the table, true means the input still has to be run
+bool CompiledDFA::mayAccept(const char * input, size_t length) const
+{
+	if(length < this->minimumLength || length > this->maximumLength)
+	{
+		return false;
+	}
+	if(length > 0 && !this->firstSymbols.test((unsigned char)input[0]))
+	{
+		return false;
+	}
+	for(int index = 0; index < this->requiredSymbolsList.size(); index++)
+	{
+		if(memchr(input,this->requiredSymbolsList[index],length) == NULL)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void CompiledDFA::clear()
+{
+	this->statesCount = 0;
+	this->initialState = CompiledDFA::ERROR_STATE_INDEX;
+	this->classesCount = 0;
+	this->symbolClasses.clear();
+	this->transitionTable.clear();
+	this->finalStates.clear();
+	this->stateTags.clear();
+	this->requiredSymbolsList.clear();
+	this->classes = NULL;
+	this->table = NULL;
+	this->finals = NULL;
+	this->tags = NULL;
+	this->states.clear();
+	if(this->mappedMemory != NULL)
+	{
+		munmap(this->mappedMemory,this->mappedSize);
+		this->mappedMemory = NULL;
+		this->mappedSize = 0;
+	}
+}
@@ -0,0 +1,83 @@
+// CompiledDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __compiled_dfa__
+#define __compiled_dfa__
+
+#include <map>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <functional>
+#include <string_view>
+#include <sys/mman.h>
+#include "State.h"
+
+using namespace std;
+
+class CompiledDFA
+{
+	private:
+		int statesCount;
+		int initialState;
+		int classesCount;
+		vector<unsigned char> symbolClasses;
+		vector<int> transitionTable;
+		vector<unsigned char> finalStates;
+		vector<int> stateTags;
+		const unsigned char * classes;
+		const int * table;
+		const unsigned char * finals;
+		const int * tags;
+		vector<State *> states;
+		void * mappedMemory;
+		size_t mappedSize;
+		SymbolSet firstSymbols;
+		SymbolSet requiredSymbols;
+		vector<unsigned char> requiredSymbolsList;
+		size_t minimumLength;
+		size_t maximumLength;
+		bool isAccepting(int avoidedClass) const;
+		void computePrefilters();
+		void enumerateChunk(const char * input, size_t length, vector<int> & stateMap) const;
+
+	public:
+		static const int SYMBOLS_COUNT;
+		static const int ERROR_STATE_INDEX;
+		static const size_t PARALLEL_MINIMUM_CHUNK_LENGTH;
+		static const int PARALLEL_MAXIMUM_STATES_COUNT;
+		static const int ENUMERATION_MERGE_INTERVAL;
+		static const size_t UNBOUNDED_LENGTH;
+		CompiledDFA(vector<State *> states);
+		CompiledDFA(int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const unsigned char * finalStates, const int * stateTags, vector<State *> states, void * mappedMemory = NULL, size_t mappedSize = 0);
+		~CompiledDFA();
+		static int compressSymbols(vector<int> & transitionTable, int statesCount, vector<unsigned char> & symbolClasses);
+		static void writeStaticTable(ofstream & headerFile, const string & tableName, int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const vector<int> & recognizers, const vector<int> & finalStateTags);
+		static void writeDirectCodedScanner(ofstream & headerFile, const string & scannerName, int statesCount, int initialState, int classesCount, const unsigned char * symbolClasses, const int * transitionTable, const vector<int> & recognizers, const vector<int> & finalStateTags);
+		int getStatesCount() const;
+		int getClassesCount() const;
+		int getInitialState() const;
+		const unsigned char * getSymbolClasses() const;
+		const int * getTransitionTable() const;
+		const unsigned char * getFinalStates() const;
+		const int * getStateTags() const;
+		int getNextState(int state, char symbol) const;
+		bool isFinal(int state) const;
+		int getTag(int state) const;
+		State * getState(int state) const;
+		const SymbolSet & getFirstSymbols() const;
+		const SymbolSet & getRequiredSymbols() const;
+		size_t getMinimumLength() const;
+		size_t getMaximumLength() const;
+		bool mayAccept(const char * input, size_t length) const;
+		int run(int state, const char * input, size_t length) const;
+		int run(const char * input, size_t length) const;
+		int run(const string & input) const;
+		void runBatch(const string_view * inputs, int * states, size_t count) const;
+		int runParallel(const char * input, size_t length, int threadsCount) const;
+		int longestMatch(const char * begin, const char * end, size_t & length) const;
+		void clear();
+};
+
+#endif
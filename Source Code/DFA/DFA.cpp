@@ -8,13 +8,21 @@ const int DFA::EQUAL_STRINGS = 0;
 const string DFA::INVALID_DFA_EXCEPTION = "Invalid DFA";
 const string DFA::INVALID_INPUT_EXCEPTION = "Invalid input";
 const string DFA::INVALID_JSON_MODEL_EXCEPTION = "Invalid JSON model";
+const string DFA::INVALID_BINARY_MODEL_EXCEPTION = "Invalid binary model";
+const string DFA::INVALID_JFLAP_MODEL_EXCEPTION = "Invalid JFLAP model";
+const string DFA::BINARY_MODEL_MAGIC = "DFABIN2";
+const string DFA::NOT_FROZEN_EXCEPTION = "DFA not frozen";
 const int DFA::NO_DELAY = 0;
 const string DFA::EMPTY_WORD = "ϵ";
+const string DFA::TABLE_REPRESENTATION = "table";
+const string DFA::BIT_PARALLEL_REPRESENTATION = "bit-parallel";
 
 void initializeDFAValidationResult(DFAValidationResult & dfaValidationResult)
 {
 	dfaValidationResult.valid = false;
 	dfaValidationResult.currentState = NULL;
+	dfaValidationResult.stateId = CompiledDFA::ERROR_STATE_INDEX;
+	dfaValidationResult.tag = State::NO_TAG;
 }
 
 void destroyDFAValidationResult(DFAValidationResult & dfaValidationResult)
@@ -32,6 +40,16 @@ void setCurrentStateToDFAValidationResult(DFAValidationResult & dfaValidationRes
 	dfaValidationResult.currentState = state;
 }
 
+void setStateIdToDFAValidationResult(DFAValidationResult & dfaValidationResult, int stateId)
+{
+	dfaValidationResult.stateId = stateId;
+}
+
+void setTagToDFAValidationResult(DFAValidationResult & dfaValidationResult, int tag)
+{
+	dfaValidationResult.tag = tag;
+}
+
 bool getValidFromDFAValidationResult(DFAValidationResult & dfaValidationResult)
 {
 	return dfaValidationResult.valid;
@@ -42,18 +60,49 @@ State * getCurrentStateFromDFAValidationResult(DFAValidationResult & dfaValidati
 	return dfaValidationResult.currentState;
 }
 
+int getStateIdFromDFAValidationResult(DFAValidationResult & dfaValidationResult)
+{
+	return dfaValidationResult.stateId;
+}
+
+int getTagFromDFAValidationResult(DFAValidationResult & dfaValidationResult)
+{
+	return dfaValidationResult.tag;
+}
+
+void initializeDFAMatchResult(DFAMatchResult & dfaMatchResult)
+{
+	dfaMatchResult.matched = false;
+	dfaMatchResult.length = 0;
+	dfaMatchResult.acceptingState = (State *)State::ERROR_STATE;
+	dfaMatchResult.stateId = CompiledDFA::ERROR_STATE_INDEX;
+	dfaMatchResult.tag = State::NO_TAG;
+}
+
+void initializeDFAMinimizationResult(DFAMinimizationResult & dfaMinimizationResult)
+{
+	dfaMinimizationResult.statesBefore = 0;
+	dfaMinimizationResult.transitionsBefore = 0;
+	dfaMinimizationResult.statesAfter = 0;
+	dfaMinimizationResult.transitionsAfter = 0;
+}
+
 DFA::DFA(string name, string description, string alphabet, vector<State *> states)
 {
-	this->name = name;
-	this->description = description;
-	this->alphabet = alphabet;
-	this->states = states;
+	this->name = move(name);
+	this->description = move(description);
+	this->alphabet = move(alphabet);
+	this->states = move(states);
+	this->compiledDFA = NULL;
+	this->bitParallelDFA = NULL;
 	this->exceptionDescription.clear();
 	this->invalidate();
 }
 
 DFA::DFA(ifstream & dfaModelFile)
 {
+	this->compiledDFA = NULL;
+	this->bitParallelDFA = NULL;
 	this->parseJSONFile(dfaModelFile);
 	this->exceptionDescription.clear();
 	this->invalidate();
@@ -67,7 +116,18 @@ DFA::~DFA()
 void DFA::invalidate()
 {
 	this->DFAValid = false;
-	this->allTransitionsPresent = false;
+	this->frozen = false;
+	this->statesIndexed = false;
+	if(this->bitParallelDFA != NULL)
+	{
+		delete this->bitParallelDFA;
+		this->bitParallelDFA = NULL;
+	}
+	if(this->compiledDFA != NULL)
+	{
+		delete this->compiledDFA;
+		this->compiledDFA = NULL;
+	}
 }
 
 bool DFA::isDFAValid()
@@ -76,8 +136,14 @@ bool DFA::isDFAValid()
 	if(!this->DFAValid)
 	{
 		State * initialState = NULL;
+		SymbolSet alphabetSymbols;
+		unordered_set<State *> knownStates(this->states.begin(),this->states.end());
 		this->exceptionDescription.clear();
 		this->trimSymbols();
+		for(int index = 0; index < this->alphabet.length(); index++)
+		{
+			alphabetSymbols.set((unsigned char)this->alphabet[index]);
+		}
 		for(int index = 0; index < this->states.size(); index++)
 		{
 			if(valid == true)
@@ -111,14 +177,13 @@ bool DFA::isDFAValid()
 					for(int transitionIndex = 0; transitionIndex < currentState->getTransitions().size(); transitionIndex++)
 					{
 						Transition * aux = currentState->getTransitions()[transitionIndex];
-						aux->trimSymbols();
-						if(!this->hasState(aux->getSource()) && aux->getSource() != State::ERROR_STATE || !this->hasState(aux->getDestination()) && aux->getDestination() != State::ERROR_STATE)
+						if(aux->getSource() != State::ERROR_STATE && !knownStates.count(aux->getSource()) || aux->getDestination() != State::ERROR_STATE && !knownStates.count(aux->getDestination()))
 						{
 							valid = false;
 							this->exceptionDescription = "transitions have unrelated source or destination states";
 							break;
 						}
-						if(!this->areSymbolsInAlphabet(aux->getSymbols()))
+						if((aux->getSymbolSet() & ~alphabetSymbols).any())
 						{
 							valid = false;
 							this->exceptionDescription = "transitions have symbols that do not belong to the alphabet";
@@ -149,17 +214,12 @@ bool DFA::isDFAValid()
 	return valid;
 }
 
-bool DFA::isInputValid(string input)
+bool DFA::isInputValid(string_view input)
 {
 	return this->areSymbolsInAlphabet(input);
 }
 
-bool DFA::hasState(State * state)
-{
-	return find(this->states.begin(),this->states.end(),state) != this->states.end() && state != State::ERROR_STATE;
-}
-
-bool DFA::areSymbolsInAlphabet(string symbols)
+bool DFA::areSymbolsInAlphabet(string_view symbols)
 {
 	bool result = true;
 	for(int index = 0; index < symbols.length(); index++)
@@ -190,7 +250,7 @@ State * DFA::getInitialState()
 	}
 }
 
-void DFA::printPathTraceToConsole(vector<string> pathTrace, int delay)
+void DFA::printPathTraceToConsole(const vector<string> & pathTrace, int delay)
 {
 	cout << "Path trace:" << endl << endl;
 	for(int index = 0; index < pathTrace.size(); index++)
@@ -204,7 +264,7 @@ void DFA::printPathTraceToConsole(vector<string> pathTrace, int delay)
 	cout << endl;
 }
 
-void DFA::printPathTraceToFile(vector<string> pathTrace, ofstream * fileToPrint)
+void DFA::printPathTraceToFile(const vector<string> & pathTrace, ofstream * fileToPrint)
 {
 	(*fileToPrint) << "Path trace:" << endl << endl;
 	for(int index = 0; index < pathTrace.size(); index++)
@@ -214,46 +274,22 @@ void DFA::printPathTraceToFile(vector<string> pathTrace, ofstream * fileToPrint)
 	(*fileToPrint) << endl;
 }
 
-bool DFA::areAllTransitionsPresent()
+void DFA::compile()
 {
-	bool result = true;
-	if(!this->allTransitionsPresent)
-	{
-		int alphabetSize = this->alphabet.length();
-		for(int index = 0; index < this->states.size(); index++)
-		{
-			if(!this->states[index]->hasAllTransitions(this->alphabet))
-			{
-				result = false;
-			}
-		}
-	}
-	return result;
-}
-
-void DFA::addMissingTransitions()
-{
-	for(int index = 0; index < this->states.size(); index++)
+	if(this->compiledDFA == NULL)
 	{
-		if(!this->states[index]->hasAllTransitions(this->alphabet))
-		{
-			if(this->states[index] != State::ERROR_STATE)
-			{
-				this->states[index]->addMissingTransitions(this->alphabet);
-			}
-		}
+		this->compiledDFA = new CompiledDFA(this->states);
 	}
-	this->allTransitionsPresent = true;
 }
 
-DFAValidationResult DFA::analyse(string input, bool verbose, int delay, ofstream * fileToPrint)
+DFAValidationResult DFA::analyse(string_view input, bool verbose, int delay, ofstream * fileToPrint)
 {
 	DFAValidationResult result;
-	bool valid = true, changedState;
-	State * currentState = this->getInitialState(), * oldState;
+	bool valid = true;
+	int currentStateIndex = this->compiledDFA->getInitialState(), oldStateIndex;
+	State * currentState = this->compiledDFA->getState(currentStateIndex);
 	vector<string> pathTrace;
 	char currentSymbol;
-	Transition * currentTransition;
 	ostringstream aux;
 	initializeDFAValidationResult(result);
 	aux << "Input: " << ((input.length() > 0) ? input : DFA::EMPTY_WORD) << endl;
@@ -261,49 +297,23 @@ DFAValidationResult DFA::analyse(string input, bool verbose, int delay, ofstream
 	aux.str("");
 	aux << "Initialized at " << currentState->getName() << endl;
 	pathTrace.push_back(aux.str());
-	for(int index = 0; index < input.length(); index++)
+	for(int index = 0; index < input.length() && valid; index++)
 	{
-		if(valid == true)
+		aux.str("");
+		currentSymbol = input[index];
+		oldStateIndex = currentStateIndex;
+		currentStateIndex = this->compiledDFA->getNextState(currentStateIndex,currentSymbol);
+		currentState = this->compiledDFA->getState(currentStateIndex);
+		if(currentState != State::ERROR_STATE)
 		{
-			if(currentState != State::ERROR_STATE)
-			{
-				aux.str("");
-				currentSymbol = input[index];
-				changedState = false;
-				for(int transitionIndex = 0; transitionIndex < currentState->getTransitions().size(); transitionIndex++)
-				{
-					currentTransition = currentState->getTransitions()[transitionIndex];
-					if(currentTransition->hasSymbol(currentSymbol))
-					{
-						oldState = currentState;
-						currentState = currentTransition->getDestination();
-						if(currentState != State::ERROR_STATE)
-						{
-							aux << "\t" << ((oldState != State::ERROR_STATE) ? oldState->getName() : State::ERROR_STATE_NAME) << " -> Read '" << currentSymbol << "' -> " << currentState->getName();
-							changedState = true;
-						}
-						else
-						{
-							aux << "\t" << ((oldState != State::ERROR_STATE) ? oldState->getName() : State::ERROR_STATE_NAME) << " -> Read '" << currentSymbol << "' -> " << State::ERROR_STATE_NAME;
-							valid = false;
-						}
-						pathTrace.push_back(aux.str());
-					}
-					if(valid == false || changedState == true)
-					{
-						break;
-					}
-				}
-			}
-			else
-			{
-				valid = false;
-			}
+			aux << "\t" << this->compiledDFA->getState(oldStateIndex)->getName() << " -> Read '" << currentSymbol << "' -> " << currentState->getName();
 		}
 		else
 		{
-			break;
+			aux << "\t" << this->compiledDFA->getState(oldStateIndex)->getName() << " -> Read '" << currentSymbol << "' -> " << State::ERROR_STATE_NAME;
+			valid = false;
 		}
+		pathTrace.push_back(aux.str());
 	}
 	aux.str("");
 	if((input.length() > 0))
@@ -352,6 +362,19 @@ DFAValidationResult DFA::analyse(string input, bool verbose, int delay, ofstream
 	}
 	setValidToDFAValidationResult(result,valid);
 	setCurrentStateToDFAValidationResult(result,currentState);
+	setStateIdToDFAValidationResult(result,currentStateIndex);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(currentStateIndex));
+	return result;
+}
+
+DFAValidationResult DFA::analyseWithoutTrace(string_view input)
+{
+	DFAValidationResult result;
+	int currentStateIndex = this->compiledDFA->run(input.data(),input.length());
+	setValidToDFAValidationResult(result,this->compiledDFA->isFinal(currentStateIndex));
+	setCurrentStateToDFAValidationResult(result,this->compiledDFA->getState(currentStateIndex));
+	setStateIdToDFAValidationResult(result,currentStateIndex);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(currentStateIndex));
 	return result;
 }
 
@@ -390,155 +413,55 @@ string DFA::getInfo()
 	return stringStream.str();
 }
 
-void DFA::parseJSONFile(ifstream & dfaModelFile)
+int DFA::countTransitions()
 {
-	stringstream buffer;
-	Document jsonDocument;
-	bool valid = true;
-	buffer << dfaModelFile.rdbuf();
-	jsonDocument.Parse<0>(buffer.str().c_str());
-	if(!jsonDocument.IsObject())
-	{
-		this->exceptionDescription = "DFA value declared using wrong type, only one model is allowed";
-		valid = false;
-	}
-	if(valid)
+	int counter = 0;
+	for(int index = 0; index < this->states.size(); index++)
 	{
-		if(jsonDocument.HasMember("name") && jsonDocument.HasMember("description") && jsonDocument.HasMember("alphabet"))
+		const vector<Transition *> & transitions = this->states[index]->getTransitions();
+		for(int transitionIndex = 0; transitionIndex < transitions.size(); transitionIndex++)
 		{
-			if(jsonDocument["name"].IsString() && jsonDocument["description"].IsString() && jsonDocument["alphabet"].IsString())
+			if(transitions[transitionIndex]->getDestination() != State::ERROR_STATE)
 			{
-				this->name = jsonDocument["name"].GetString();
-				this->description = jsonDocument["description"].GetString();
-				this->alphabet = jsonDocument["alphabet"].GetString();
-			}
-			else
-			{
-				this->exceptionDescription = "DFA name, description or alphabet values declared using wrong type";
-				valid = false;
+				counter += transitions[transitionIndex]->getSymbolsCount();
 			}
 		}
-		else
-		{
-			this->exceptionDescription = "DFA name, description or alphabet keys missing";
-			valid = false;
-		}
 	}
-	if(valid)
+	return counter;
+}
+
+// Single streaming pass over the model, transition destinations are then resolved through the states index
+void DFA::parseJSONFile(ifstream & dfaModelFile)
+{
+	DFAJSONModelReader reader;
+	if(!reader.read(dfaModelFile))
 	{
-		if(jsonDocument.HasMember("states"))
-		{
-			if(jsonDocument["states"].IsArray())
-			{
-				const Value& statesKey = jsonDocument["states"];
-				for(SizeType index = 0; index < statesKey.Size(); index++)
-				{
-					if(statesKey[index].IsObject())
-					{
-						if(statesKey[index].HasMember("name") && statesKey[index].HasMember("initial") && statesKey[index].HasMember("final") && statesKey[index].HasMember("recognitionMessage"))
-						{
-							if(statesKey[index]["name"].IsString() && statesKey[index]["initial"].IsBool() && statesKey[index]["final"].IsBool() && statesKey[index]["recognitionMessage"].IsString())
-							{
-								this->states.push_back(new State(statesKey[index]["name"].GetString(),statesKey[index]["initial"].GetBool(),statesKey[index]["final"].GetBool(),vector<Transition *>(),statesKey[index]["recognitionMessage"].GetString()));
-							}
-							else
-							{
-								this->exceptionDescription = "State name, initial, final or recognitionMessage values declared using wrong type";
-								valid = false;
-							}
-						}
-						else
-						{
-							this->exceptionDescription = "State name, initial, final or recognitionMessage keys missing";
-							valid = false;
-						}
-					}
-					else
-					{
-						this->exceptionDescription = "State value declared using wrong type";
-						valid = false;
-					}
-				}
-			}
-			else
-			{
-				this->exceptionDescription = "DFA states value declared using wrong type missing";
-				valid = false;
-			}
-		}
-		else
-		{
-			this->exceptionDescription = "DFA states key missing";
-			valid = false;
-		}
+		string helper = reader.getExceptionDescription();
+		this->clear();
+		throw INVALID_JSON_MODEL_EXCEPTION + ": " + helper;
 	}
-	if(valid)
+	this->name = reader.getName();
+	this->description = reader.getDescription();
+	this->alphabet = reader.getAlphabet();
+	this->states = reader.getStates();
+	this->indexStates();
+	const vector<DFAJSONModelTransition> & transitions = reader.getTransitions();
+	for(int index = 0; index < transitions.size(); index++)
 	{
-		const Value& statesKey = jsonDocument["states"];
-		for(SizeType index = 0; index < statesKey.Size(); index++)
-		{
-			if(statesKey[index].HasMember("transitions"))
-			{
-				if(statesKey[index]["transitions"].IsArray())
-				{
-					const Value& transitionsKey = statesKey[index]["transitions"];
-					State * currentState = this->findState(statesKey[index]["name"].GetString());
-					if(currentState != State::ERROR_STATE)
-					{
-						for(SizeType transitionsKeyIndex = 0; transitionsKeyIndex < transitionsKey.Size(); transitionsKeyIndex++)
-						{
-							if(transitionsKey[transitionsKeyIndex].IsObject())
-							{
-								if(transitionsKey[transitionsKeyIndex].HasMember("symbol") && transitionsKey[transitionsKeyIndex].HasMember("destination"))
-								{
-									if(transitionsKey[transitionsKeyIndex]["symbol"].IsString() && transitionsKey[transitionsKeyIndex]["destination"].IsString())
-									{
-										currentState->addTransition(transitionsKey[transitionsKeyIndex]["symbol"].GetString(),this->findState(transitionsKey[transitionsKeyIndex]["destination"].GetString()));
-									}
-									else
-									{
-										this->exceptionDescription = "Transition symbol or destination values declared using wrong type";
-										valid = false;
-									}
-								}
-								else
-								{
-									this->exceptionDescription = "Transition symbol or destination keys missing";
-									valid = false;
-								}
-							}
-							else
-							{
-								this->exceptionDescription = "Transition value declared using wrong type";
-								valid = false;
-							}
-						}
-					}
-					else
-					{
-						this->exceptionDescription = "Unknown error";
-						valid = false;
-					}
-				}
-				else
-				{
-					this->exceptionDescription = "State transitions value declared using wrong type missing";
-					valid = false;
-				}
-			}
-			else
-			{
-				this->exceptionDescription = "State transitions key missing";
-				valid = false;
-			}
-		}
+		this->states[transitions[index].source]->addTransition(transitions[index].symbols,this->findState(transitions[index].destination));
 	}
-	if(!valid)
+}
+
+// The first state of each name is indexed, as the linear lookup used to find it
+void DFA::indexStates()
+{
+	this->statesIndexes.clear();
+	this->statesIndexes.reserve(this->states.size());
+	for(int index = 0; index < this->states.size(); index++)
 	{
-		string helper = this->exceptionDescription;
-		this->clear();
-		throw INVALID_JSON_MODEL_EXCEPTION + ": " + helper;
+		this->statesIndexes.emplace(this->states[index]->getName(),index);
 	}
+	this->statesIndexed = true;
 }
 
 State * DFA::findState(State * state)
@@ -553,58 +476,59 @@ State * DFA::findState(State * state)
 	}
 }
 
-State * DFA::findState(string name)
+State * DFA::findState(const string & name)
 {
-	for(int index = 0; index < this->states.size(); index++)
+	unordered_map<string,int>::iterator index = this->statesIndexes.find(name);
+
+	// Missing or stale entries (states renamed since indexed) rebuild the index once until the states change
+	if(index == this->statesIndexes.end() && !this->statesIndexed || index != this->statesIndexes.end() && (index->second >= this->states.size() || this->states[index->second]->getName().compare(name) != DFA::EQUAL_STRINGS))
 	{
-		if(this->states[index]->getName().compare(name) == DFA::EQUAL_STRINGS)
-		{
-			return this->states[index];
-		}
+		this->indexStates();
+		index = this->statesIndexes.find(name);
 	}
-	return NULL;
+	return ((index != this->statesIndexes.end()) ? this->states[index->second] : NULL);
 }
 
 void DFA::setName(string name)
 {
-	this->name = name;
+	this->name = move(name);
 	this->invalidate();
 }
 
 void DFA::setDescription(string description)
 {
-	this->description = description;
+	this->description = move(description);
 	this->invalidate();
 }
 
 void DFA::setAlphabet(string alphabet)
 {
-	this->alphabet = alphabet;
+	this->alphabet = move(alphabet);
 	this->invalidate();
 }
 
 void DFA::setStates(vector<State *> states)
 {
-	this->states = states;
+	this->states = move(states);
 	this->invalidate();
 }
 
-string DFA::getName()
+const string & DFA::getName() const
 {
 	return this->name;
 }
 
-string DFA::getDescription()
+const string & DFA::getDescription() const
 {
 	return this->description;
 }
 
-string DFA::getAlphabet()
+const string & DFA::getAlphabet() const
 {
 	return this->alphabet;
 }
 
-vector<State *> DFA::getStates()
+const vector<State *> & DFA::getStates() const
 {
 	return this->states;
 }
@@ -627,7 +551,7 @@ bool DFA::removeState(State * state)
 	}
 }
 
-bool DFA::removeState(string state)
+bool DFA::removeState(string_view state)
 {
 	bool removed = false;
 	for(int index = 0; index < this->states.size(); index++)
@@ -647,23 +571,542 @@ bool DFA::removeState(string state)
 
 void DFA::preValidate()
 {
-	this->isDFAValid();
+	if(this->isDFAValid())
+	{
+		this->compile();
+	}
+}
+
+DFAMinimizationResult DFA::minimize()
+{
+	DFAMinimizationResult result;
+	CompiledDFA * compiled = this->getCompiledDFA();
+	int statesCount = compiled->getStatesCount(), deadState = statesCount, symbolsCount = this->alphabet.length();
+	vector<bool> reachable(statesCount + 1,false);
+	vector<int> pendingStates, blockOf(statesCount + 1), representatives;
+	vector< vector<int> > blocks, inverse((statesCount + 1) * symbolsCount);
+	map<pair<bool,int>,int> initialBlocks;
+	vector<bool> inWorklist;
+	vector<int> worklist;
+	vector<State *> minimizedStates;
+	initializeDFAMinimizationResult(result);
+	result.statesBefore = this->states.size();
+	result.transitionsBefore = this->countTransitions();
+
+	// Finds the reachable states, the dead state stands for the error state
+	reachable[deadState] = true;
+	if(compiled->getInitialState() != CompiledDFA::ERROR_STATE_INDEX)
+	{
+		reachable[compiled->getInitialState()] = true;
+		pendingStates.push_back(compiled->getInitialState());
+	}
+	for(int index = 0; index < pendingStates.size(); index++)
+	{
+		for(int symbol = 0; symbol < symbolsCount; symbol++)
+		{
+			int destination = compiled->getNextState(pendingStates[index],this->alphabet[symbol]);
+			if(destination != CompiledDFA::ERROR_STATE_INDEX && !reachable[destination])
+			{
+				reachable[destination] = true;
+				pendingStates.push_back(destination);
+			}
+		}
+	}
+
+	// Builds the inverse transitions and the initial partition, states start in one block per (final, tag)
+	for(int state = 0; state <= statesCount; state++)
+	{
+		if(reachable[state])
+		{
+			int compiledState = ((state != deadState) ? state : CompiledDFA::ERROR_STATE_INDEX);
+			pair<bool,int> key(compiled->isFinal(compiledState),compiled->getTag(compiledState));
+			for(int symbol = 0; symbol < symbolsCount; symbol++)
+			{
+				int destination = ((state != deadState) ? compiled->getNextState(state,this->alphabet[symbol]) : CompiledDFA::ERROR_STATE_INDEX);
+				inverse[((destination != CompiledDFA::ERROR_STATE_INDEX) ? destination : deadState) * symbolsCount + symbol].push_back(state);
+			}
+			if(!initialBlocks.count(key))
+			{
+				initialBlocks[key] = blocks.size();
+				blocks.push_back(vector<int>());
+			}
+			blockOf[state] = initialBlocks[key];
+			blocks[blockOf[state]].push_back(state);
+		}
+	}
+	for(int block = 0; block < blocks.size(); block++)
+	{
+		worklist.push_back(block);
+		inWorklist.push_back(true);
+	}
+
+	// Refines the partition (Hopcroft)
+	while(!worklist.empty())
+	{
+		int splitter = worklist.back();
+		vector<int> splitterStates = blocks[splitter];
+		worklist.pop_back();
+		inWorklist[splitter] = false;
+		for(int symbol = 0; symbol < symbolsCount; symbol++)
+		{
+			map<int,vector<int> > touched;
+			for(int index = 0; index < splitterStates.size(); index++)
+			{
+				vector<int> & sources = inverse[splitterStates[index] * symbolsCount + symbol];
+				for(int source = 0; source < sources.size(); source++)
+				{
+					touched[blockOf[sources[source]]].push_back(sources[source]);
+				}
+			}
+			for(map<int,vector<int> >::iterator iterator = touched.begin(); iterator != touched.end(); iterator++)
+			{
+				int block = iterator->first, newBlock = blocks.size();
+				vector<int> & movedStates = iterator->second;
+				if(movedStates.size() < blocks[block].size())
+				{
+					vector<int> keptStates;
+					for(int index = 0; index < movedStates.size(); index++)
+					{
+						blockOf[movedStates[index]] = newBlock;
+					}
+					for(int index = 0; index < blocks[block].size(); index++)
+					{
+						if(blockOf[blocks[block][index]] == block)
+						{
+							keptStates.push_back(blocks[block][index]);
+						}
+					}
+					blocks[block] = keptStates;
+					blocks.push_back(movedStates);
+					inWorklist.push_back(false);
+					if(inWorklist[block] || movedStates.size() <= keptStates.size())
+					{
+						worklist.push_back(newBlock);
+						inWorklist[newBlock] = true;
+					}
+					else
+					{
+						worklist.push_back(block);
+						inWorklist[block] = true;
+					}
+				}
+			}
+		}
+	}
+
+	// Picks a representative state for every block, the initial one has priority and is always kept
+	representatives.assign(blocks.size(),CompiledDFA::ERROR_STATE_INDEX);
+	for(int state = 0; state < statesCount; state++)
+	{
+		if(reachable[state] && (blockOf[state] != blockOf[deadState] || state == compiled->getInitialState()))
+		{
+			int & representative = representatives[blockOf[state]];
+			if(representative == CompiledDFA::ERROR_STATE_INDEX || state == compiled->getInitialState())
+			{
+				representative = state;
+			}
+		}
+	}
+
+	// Rebuilds the states and transitions over the representatives, dropping the others
+	for(int state = 0; state < statesCount; state++)
+	{
+		if(reachable[state] && representatives[blockOf[state]] == state)
+		{
+			State * currentState = this->states[state];
+			vector<Transition *> oldTransitions = currentState->getTransitions();
+			map<int,string> symbolsByBlock;
+			for(int symbol = 0; symbol < symbolsCount; symbol++)
+			{
+				int destination = compiled->getNextState(state,this->alphabet[symbol]);
+				if(destination != CompiledDFA::ERROR_STATE_INDEX && blockOf[destination] != blockOf[deadState])
+				{
+					symbolsByBlock[blockOf[destination]].push_back(this->alphabet[symbol]);
+				}
+			}
+			for(int index = 0; index < oldTransitions.size(); index++)
+			{
+				delete oldTransitions[index];
+			}
+			currentState->setTransitions(vector<Transition *>());
+			for(map<int,string>::iterator iterator = symbolsByBlock.begin(); iterator != symbolsByBlock.end(); iterator++)
+			{
+				currentState->addTransition(iterator->second,this->states[representatives[iterator->first]]);
+			}
+			minimizedStates.push_back(currentState);
+		}
+		else
+		{
+			delete this->states[state];
+		}
+	}
+	this->states = minimizedStates;
+	this->invalidate();
+	result.statesAfter = this->states.size();
+	result.transitionsAfter = this->countTransitions();
+	return result;
+}
+
+void DFA::saveBinaryModel(const string & binaryModelPath)
+{
+	CompiledDFA * compiled = this->getCompiledDFA();
+	DFABinaryModelHeader header;
+	ofstream binaryModelFile;
+	string strings;
+	strings.append(this->name).push_back('\0');
+	strings.append(this->description).push_back('\0');
+	strings.append(this->alphabet).push_back('\0');
+	for(int index = 0; index < this->states.size(); index++)
+	{
+		strings.append(this->states[index]->getName()).push_back('\0');
+		strings.append(this->states[index]->getRecognitionMessage()).push_back('\0');
+	}
+	memset(&header,0,sizeof(header));
+	memcpy(header.magic,DFA::BINARY_MODEL_MAGIC.c_str(),DFA::BINARY_MODEL_MAGIC.length());
+	header.statesCount = compiled->getStatesCount();
+	header.initialState = compiled->getInitialState();
+	header.classesCount = compiled->getClassesCount();
+	header.stringsLength = strings.length();
+	binaryModelFile.open(binaryModelPath.c_str(),ios::out | ios::binary | ios::trunc);
+	if(!binaryModelFile.good())
+	{
+		throw DFA::INVALID_BINARY_MODEL_EXCEPTION + ": could not write " + binaryModelPath;
+	}
+	binaryModelFile.write((const char *)&header,sizeof(header));
+	binaryModelFile.write((const char *)compiled->getSymbolClasses(),CompiledDFA::SYMBOLS_COUNT);
+	binaryModelFile.write((const char *)compiled->getTransitionTable(),header.statesCount * header.classesCount * sizeof(int));
+	binaryModelFile.write((const char *)compiled->getStateTags(),header.statesCount * sizeof(int));
+	binaryModelFile.write((const char *)compiled->getFinalStates(),header.statesCount);
+	binaryModelFile.write(strings.data(),strings.length());
+	binaryModelFile.close();
+}
+
+DFA * DFA::loadBinaryModel(const string & binaryModelPath)
+{
+	int binaryModelFile = open(binaryModelPath.c_str(),O_RDONLY);
+	struct stat binaryModelStatus;
+	void * memory;
+	size_t size;
+	const char * base, * strings, * cursor;
+	const DFABinaryModelHeader * header;
+	const unsigned char * symbolClasses, * finalStates;
+	const int * transitionTable, * stateTags;
+	vector<string> fields;
+	vector<State *> states;
+	DFA * dfa;
+	string exceptionDescription;
+	if(binaryModelFile < 0 || fstat(binaryModelFile,&binaryModelStatus) != 0 || binaryModelStatus.st_size < sizeof(DFABinaryModelHeader))
+	{
+		if(binaryModelFile >= 0)
+		{
+			close(binaryModelFile);
+		}
+		throw DFA::INVALID_BINARY_MODEL_EXCEPTION + ": could not open " + binaryModelPath;
+	}
+	size = binaryModelStatus.st_size;
+	memory = mmap(NULL,size,PROT_READ,MAP_PRIVATE,binaryModelFile,0);
+	close(binaryModelFile);
+	if(memory == MAP_FAILED)
+	{
+		throw DFA::INVALID_BINARY_MODEL_EXCEPTION + ": could not map " + binaryModelPath;
+	}
+	base = (const char *)memory;
+	header = (const DFABinaryModelHeader *)base;
+	if(memcmp(header->magic,DFA::BINARY_MODEL_MAGIC.c_str(),DFA::BINARY_MODEL_MAGIC.length() + 1) != 0)
+	{
+		exceptionDescription = "unknown file format";
+	}
+	else if(header->statesCount < 0 || header->classesCount <= 0 || header->classesCount > CompiledDFA::SYMBOLS_COUNT || header->stringsLength <= 0
+		|| header->initialState < CompiledDFA::ERROR_STATE_INDEX || header->initialState >= header->statesCount
+		|| size != sizeof(DFABinaryModelHeader) + CompiledDFA::SYMBOLS_COUNT + (size_t)header->statesCount * header->classesCount * sizeof(int) + header->statesCount * sizeof(int) + header->statesCount + header->stringsLength)
+	{
+		exceptionDescription = "inconsistent header";
+	}
+	else
+	{
+		symbolClasses = (const unsigned char *)(base + sizeof(DFABinaryModelHeader));
+		transitionTable = (const int *)(symbolClasses + CompiledDFA::SYMBOLS_COUNT);
+		stateTags = transitionTable + header->statesCount * header->classesCount;
+		finalStates = (const unsigned char *)(stateTags + header->statesCount);
+		strings = (const char *)(finalStates + header->statesCount);
+		for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT && exceptionDescription.empty(); symbol++)
+		{
+			if(symbolClasses[symbol] >= header->classesCount)
+			{
+				exceptionDescription = "symbol classes out of range";
+			}
+		}
+		for(int index = 0; index < header->statesCount * header->classesCount && exceptionDescription.empty(); index++)
+		{
+			if(transitionTable[index] < CompiledDFA::ERROR_STATE_INDEX || transitionTable[index] >= header->statesCount)
+			{
+				exceptionDescription = "transitions out of range";
+			}
+		}
+		for(int index = 0; index < header->statesCount && exceptionDescription.empty(); index++)
+		{
+			if(stateTags[index] < State::NO_TAG)
+			{
+				exceptionDescription = "tags out of range";
+			}
+		}
+		if(strings[header->stringsLength - 1] != '\0')
+		{
+			exceptionDescription = "unterminated strings";
+		}
+		for(cursor = strings; exceptionDescription.empty() && cursor < strings + header->stringsLength; cursor += strlen(cursor) + 1)
+		{
+			fields.push_back(cursor);
+		}
+		if(exceptionDescription.empty() && fields.size() != 3 + 2 * header->statesCount)
+		{
+			exceptionDescription = "missing names or recognition messages";
+		}
+	}
+	if(!exceptionDescription.empty())
+	{
+		munmap(memory,size);
+		throw DFA::INVALID_BINARY_MODEL_EXCEPTION + ": " + exceptionDescription;
+	}
+	for(int index = 0; index < header->statesCount; index++)
+	{
+		states.push_back(new State(fields[3 + 2 * index],index == header->initialState,finalStates[index] != 0,vector<Transition *>(),fields[4 + 2 * index]));
+		states.back()->setTag(stateTags[index]);
+	}
+	for(int index = 0; index < header->statesCount; index++)
+	{
+		map<int,string> symbolsByDestination;
+		for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+		{
+			int destination = transitionTable[index * header->classesCount + symbolClasses[symbol]];
+			if(destination != CompiledDFA::ERROR_STATE_INDEX)
+			{
+				symbolsByDestination[destination].push_back((char)symbol);
+			}
+		}
+		for(map<int,string>::iterator iterator = symbolsByDestination.begin(); iterator != symbolsByDestination.end(); iterator++)
+		{
+			states[index]->addTransition(iterator->second,states[iterator->first]);
+		}
+	}
+	dfa = new DFA(fields[0],fields[1],fields[2],states);
+	dfa->DFAValid = true;
+	dfa->compiledDFA = new CompiledDFA(header->statesCount,header->initialState,header->classesCount,symbolClasses,transitionTable,finalStates,stateTags,states,memory,size);
+	return dfa;
 }
 
-DFAValidationResult DFA::validate(string input, bool deepValidation, bool verbose, int delay, ofstream * fileToPrint)
+// Reads a JFLAP finite automaton (.jff) as a stream, states are indexed by their JFLAP id as they are read
+// The alphabet is made of every symbol read by some transition, JFLAP has no tags so none are set
+DFA * DFA::loadJFlapModel(const string & jflapModelPath, string name, string description)
+{
+	ifstream jflapModelFile(jflapModelPath,ios::in);
+	vector<State *> states;
+	unordered_map<string,State *> statesById;
+	map<string,map<string,string> > transitionsSymbols;
+	State * currentState = NULL;
+	string currentElement, type, alphabet, from, to, read;
+	bool insideTransition = false;
+	if(!jflapModelFile.is_open())
+	{
+		throw DFA::INVALID_JFLAP_MODEL_EXCEPTION + ": could not open " + jflapModelPath;
+	}
+	try
+	{
+		XMLReader reader(jflapModelFile);
+		for(int event = reader.next(); event != XMLReader::END_OF_DOCUMENT; event = reader.next())
+		{
+			if(event == XMLReader::START_ELEMENT)
+			{
+				currentElement = reader.getName();
+				if(currentElement == "state")
+				{
+					string id = reader.getAttribute("id");
+					if(!reader.hasAttribute("id") || statesById.find(id) != statesById.end())
+					{
+						throw string("states with missing or repeated ids were found");
+					}
+					currentState = new State(reader.hasAttribute("name") ? reader.getAttribute("name") : "q" + id,false,false,vector<Transition *>(),"recognition failed");
+					states.push_back(currentState);
+					statesById[id] = currentState;
+				}
+				else if(currentElement == "initial" && currentState != NULL)
+				{
+					currentState->setInitial(true);
+				}
+				else if(currentElement == "final" && currentState != NULL)
+				{
+					currentState->setFinal(true);
+					currentState->setRecognitionMessage("recognition succeed");
+				}
+				else if(currentElement == "transition")
+				{
+					insideTransition = true;
+					from.clear();
+					to.clear();
+					read.clear();
+				}
+			}
+			else if(event == XMLReader::TEXT)
+			{
+				if(currentElement == "type")
+				{
+					type += reader.getText();
+				}
+				else if(insideTransition && currentElement == "from")
+				{
+					from += reader.getText();
+				}
+				else if(insideTransition && currentElement == "to")
+				{
+					to += reader.getText();
+				}
+				else if(insideTransition && currentElement == "read")
+				{
+					read += reader.getText();
+				}
+			}
+			else
+			{
+				if(reader.getName() == "type" && type != "fa")
+				{
+					throw string("only finite automata are supported");
+				}
+				if(reader.getName() == "state")
+				{
+					currentState = NULL;
+				}
+				else if(reader.getName() == "transition")
+				{
+					insideTransition = false;
+					transitionsSymbols[from][to] += read;
+					alphabet += read;
+				}
+				currentElement.clear();
+			}
+		}
+		for(map<string,map<string,string> >::iterator source = transitionsSymbols.begin(); source != transitionsSymbols.end(); source++)
+		{
+			unordered_map<string,State *>::iterator sourceState = statesById.find(source->first);
+			if(sourceState == statesById.end())
+			{
+				throw string("transitions have unknown source states");
+			}
+			for(map<string,string>::iterator destination = source->second.begin(); destination != source->second.end(); destination++)
+			{
+				unordered_map<string,State *>::iterator destinationState = statesById.find(destination->first);
+				if(destinationState == statesById.end())
+				{
+					throw string("transitions have unknown destination states");
+				}
+				sourceState->second->addTransition(destination->second,destinationState->second);
+			}
+		}
+	}
+	catch(const string exception)
+	{
+		for(int index = 0; index < states.size(); index++)
+		{
+			delete states[index];
+		}
+		throw DFA::INVALID_JFLAP_MODEL_EXCEPTION + ": " + exception;
+	}
+	sort(alphabet.begin(),alphabet.end());
+	alphabet.erase(unique(alphabet.begin(),alphabet.end()),alphabet.end());
+	return new DFA(name,description,alphabet,states);
+}
+
+void DFA::saveStaticModel(ofstream & headerFile, const string & tableName)
+{
+	CompiledDFA * compiled = this->getCompiledDFA();
+	vector<int> recognizers, finalStateTags;
+	for(int index = 0; index < compiled->getStatesCount(); index++)
+	{
+		recognizers.push_back((compiled->isFinal(index)) ? 0 : -1);
+		finalStateTags.push_back((compiled->isFinal(index)) ? compiled->getTag(index) : State::NO_TAG);
+	}
+	CompiledDFA::writeStaticTable(headerFile,tableName,compiled->getStatesCount(),compiled->getInitialState(),compiled->getClassesCount(),compiled->getSymbolClasses(),compiled->getTransitionTable(),recognizers,finalStateTags);
+}
+
+void DFA::saveDirectCodedModel(ofstream & headerFile, const string & scannerName)
+{
+	CompiledDFA * compiled = this->getCompiledDFA();
+	vector<int> recognizers, finalStateTags;
+	for(int index = 0; index < compiled->getStatesCount(); index++)
+	{
+		recognizers.push_back((compiled->isFinal(index)) ? 0 : -1);
+		finalStateTags.push_back((compiled->isFinal(index)) ? compiled->getTag(index) : State::NO_TAG);
+	}
+	CompiledDFA::writeDirectCodedScanner(headerFile,scannerName,compiled->getStatesCount(),compiled->getInitialState(),compiled->getClassesCount(),compiled->getSymbolClasses(),compiled->getTransitionTable(),recognizers,finalStateTags);
+}
+
+CompiledDFA * DFA::getCompiledDFA()
+{
+	if(!this->isDFAValid())
+	{
+		throw DFA::INVALID_DFA_EXCEPTION + ": " + this->exceptionDescription;
+	}
+	this->compile();
+	return this->compiledDFA;
+}
+
+const CompiledDFA * DFA::getCompiledDFA() const
+{
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	return this->compiledDFA;
+}
+
+void DFA::freeze()
+{
+	if(!this->frozen)
+	{
+		if(!this->isDFAValid())
+		{
+			throw DFA::INVALID_DFA_EXCEPTION + ": " + this->exceptionDescription;
+		}
+		this->compile();
+		this->bitParallelDFA = BitParallelDFA::compile(this->compiledDFA);
+		this->frozen = true;
+	}
+}
+
+bool DFA::isFrozen() const
+{
+	return this->frozen;
+}
+
+string DFA::getRepresentation() const
+{
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	return ((this->bitParallelDFA != NULL) ? DFA::BIT_PARALLEL_REPRESENTATION : DFA::TABLE_REPRESENTATION);
+}
+
+int DFA::run(const char * input, size_t length) const
+{
+	return ((this->bitParallelDFA != NULL) ? this->bitParallelDFA->run(input,length) : this->compiledDFA->run(input,length));
+}
+
+DFAValidationResult DFA::validate(string_view input, bool deepValidation, bool verbose, int delay, ofstream * fileToPrint)
 {
 	DFAValidationResult result;
+	initializeDFAValidationResult(result);
+	if(this->frozen && !verbose && fileToPrint == NULL)
+	{
+		return ((const DFA *)this)->validate(input);
+	}
 	if(deepValidation)
 	{
 		if(this->isDFAValid())
 		{
 			if(this->isInputValid(input))
 			{
-				if(!this->areAllTransitionsPresent())
-				{
-					this->addMissingTransitions();
-				}
-				result = this->analyse(input,verbose,delay,fileToPrint);
+				this->compile();
+				result = ((verbose || fileToPrint != NULL) ? this->analyse(input,verbose,delay,fileToPrint) : this->analyseWithoutTrace(input));
 			}
 			else
 			{
@@ -680,11 +1123,8 @@ DFAValidationResult DFA::validate(string input, bool deepValidation, bool verbos
 	{
 		if(this->isInputValid(input))
 		{
-			if(!this->areAllTransitionsPresent())
-			{
-				this->addMissingTransitions();
-			}
-			result = this->analyse(input,verbose,delay,fileToPrint);
+			this->compile();
+			result = ((verbose || fileToPrint != NULL) ? this->analyse(input,verbose,delay,fileToPrint) : this->analyseWithoutTrace(input));
 		}
 		else
 		{
@@ -695,6 +1135,105 @@ DFAValidationResult DFA::validate(string input, bool deepValidation, bool verbos
 	return result;
 }
 
+DFAValidationResult DFA::validate(const char * input, size_t length) const
+{
+	DFAValidationResult result;
+	int currentStateIndex;
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	currentStateIndex = this->run(input,length);
+	setValidToDFAValidationResult(result,this->compiledDFA->isFinal(currentStateIndex));
+	setCurrentStateToDFAValidationResult(result,this->compiledDFA->getState(currentStateIndex));
+	setStateIdToDFAValidationResult(result,currentStateIndex);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(currentStateIndex));
+	return result;
+}
+
+DFAValidationResult DFA::validate(string_view input) const
+{
+	return this->validate(input.data(),input.length());
+}
+
+bool DFA::accepts(const char * input, size_t length) const
+{
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	return this->compiledDFA->mayAccept(input,length) && this->compiledDFA->isFinal(this->run(input,length));
+}
+
+bool DFA::accepts(string_view input) const
+{
+	return this->accepts(input.data(),input.length());
+}
+
+void DFA::validateBatch(const string_view * inputs, DFAValidationResult * results, size_t count) const
+{
+	vector<int> states(count);
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	if(this->bitParallelDFA != NULL)
+	{
+		for(size_t index = 0; index < count; index++)
+		{
+			states[index] = this->bitParallelDFA->run(inputs[index].data(),inputs[index].length());
+		}
+	}
+	else
+	{
+		this->compiledDFA->runBatch(inputs,states.data(),count);
+	}
+	for(size_t index = 0; index < count; index++)
+	{
+		setValidToDFAValidationResult(results[index],this->compiledDFA->isFinal(states[index]));
+		setCurrentStateToDFAValidationResult(results[index],this->compiledDFA->getState(states[index]));
+		setStateIdToDFAValidationResult(results[index],states[index]);
+		setTagToDFAValidationResult(results[index],this->compiledDFA->getTag(states[index]));
+	}
+}
+
+void DFA::validateBatch(const vector<string_view> & inputs, vector<DFAValidationResult> & results) const
+{
+	results.resize(inputs.size());
+	this->validateBatch(inputs.data(),results.data(),inputs.size());
+}
+
+DFAValidationResult DFA::validateParallel(const char * input, size_t length, int threadsCount) const
+{
+	DFAValidationResult result;
+	int currentStateIndex;
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	initializeDFAValidationResult(result);
+	currentStateIndex = this->compiledDFA->runParallel(input,length,threadsCount);
+	setValidToDFAValidationResult(result,this->compiledDFA->isFinal(currentStateIndex));
+	setCurrentStateToDFAValidationResult(result,this->compiledDFA->getState(currentStateIndex));
+	setStateIdToDFAValidationResult(result,currentStateIndex);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(currentStateIndex));
+	return result;
+}
+
+DFAMatchResult DFA::longestMatch(const char * begin, const char * end) const
+{
+	DFAMatchResult result;
+	if(!this->frozen)
+	{
+		throw DFA::NOT_FROZEN_EXCEPTION;
+	}
+	result.stateId = this->compiledDFA->longestMatch(begin,end,result.length);
+	result.matched = result.stateId != CompiledDFA::ERROR_STATE_INDEX;
+	result.acceptingState = this->compiledDFA->getState(result.stateId);
+	result.tag = this->compiledDFA->getTag(result.stateId);
+	return result;
+}
+
 void DFA::clear()
 {
 	this->name.clear();
@@ -7,7 +7,17 @@
 
 #include <unistd.h>
 #include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include "State.h"
+#include "CompiledDFA.h"
+#include "BitParallelDFA.h"
+#include "XMLReader.h"
+#include "DFAJSONModelReader.h"
 #include "rapidjson/document.h"
 
 using namespace std;
@@ -16,7 +26,9 @@ using namespace rapidjson;
 typedef struct DFAValidationResult
 {
 	bool valid;
-	State * currentState;				
+	State * currentState;
+	int stateId;
+	int tag;
 }
 DFAValidationResult;
 
@@ -25,7 +37,44 @@ void destroyDFAValidationResult(DFAValidationResult & dfaValidationResult);
 void setValidToDFAValidationResult(DFAValidationResult & dfaValidationResult, bool valid);
 void setCurrentStateToDFAValidationResult(DFAValidationResult & dfaValidationResult, State * state);
 bool getValidFromDFAValidationResult(DFAValidationResult & dfaValidationResult);
+void setStateIdToDFAValidationResult(DFAValidationResult & dfaValidationResult, int stateId);
+void setTagToDFAValidationResult(DFAValidationResult & dfaValidationResult, int tag);
 State * getCurrentStateFromDFAValidationResult(DFAValidationResult & dfaValidationResult);
+int getStateIdFromDFAValidationResult(DFAValidationResult & dfaValidationResult);
+int getTagFromDFAValidationResult(DFAValidationResult & dfaValidationResult);
+
+typedef struct DFAMatchResult
+{
+	bool matched;
+	size_t length;
+	State * acceptingState;
+	int stateId;
+	int tag;
+}
+DFAMatchResult;
+
+void initializeDFAMatchResult(DFAMatchResult & dfaMatchResult);
+
+typedef struct DFAMinimizationResult
+{
+	int statesBefore;
+	int transitionsBefore;
+	int statesAfter;
+	int transitionsAfter;
+}
+DFAMinimizationResult;
+
+void initializeDFAMinimizationResult(DFAMinimizationResult & dfaMinimizationResult);
+
+typedef struct DFABinaryModelHeader
+{
+	char magic[8];
+	int statesCount;
+	int initialState;
+	int classesCount;
+	int stringsLength;
+}
+DFABinaryModelHeader;
 
 class DFA
 {
@@ -34,33 +83,45 @@ class DFA
 		static const string INVALID_DFA_EXCEPTION;
 		static const string INVALID_INPUT_EXCEPTION;
 		static const string INVALID_JSON_MODEL_EXCEPTION;
+		static const string INVALID_BINARY_MODEL_EXCEPTION;
+		static const string INVALID_JFLAP_MODEL_EXCEPTION;
+		static const string NOT_FROZEN_EXCEPTION;
+		static const string BINARY_MODEL_MAGIC;
 		string name;
 		string description;
 		string alphabet;
 		vector<State *> states;
+		unordered_map<string,int> statesIndexes;
+		bool statesIndexed;
 		string exceptionDescription;
 		bool DFAValid;
-		bool allTransitionsPresent;
+		bool frozen;
+		CompiledDFA * compiledDFA;
+		BitParallelDFA * bitParallelDFA;
 		void invalidate();
 		bool isDFAValid();
-		bool isInputValid(string input);
-		bool hasState(State * state);
-		bool areSymbolsInAlphabet(string symbols);
+		bool isInputValid(string_view input);
+		bool areSymbolsInAlphabet(string_view symbols);
 		void trimSymbols();
 		State * getInitialState();
-		void printPathTraceToConsole(vector<string> pathTrace, int delay);
-		void printPathTraceToFile(vector<string> pathTrace, ofstream * fileToPrint);
-		bool areAllTransitionsPresent();
-		void addMissingTransitions();
-		DFAValidationResult analyse(string input, bool verbose, int delay, ofstream * fileToPrint);
+		void printPathTraceToConsole(const vector<string> & pathTrace, int delay);
+		void printPathTraceToFile(const vector<string> & pathTrace, ofstream * fileToPrint);
+		void compile();
+		int run(const char * input, size_t length) const;
+		DFAValidationResult analyse(string_view input, bool verbose, int delay, ofstream * fileToPrint);
+		DFAValidationResult analyseWithoutTrace(string_view input);
 		string getInfo();
+		int countTransitions();
 		void parseJSONFile(ifstream & dfaModelFile);
+		void indexStates();
 		State * findState(State * state);
-		State * findState(string name);
+		State * findState(const string & name);
 
 	public:
 		static const int NO_DELAY;
 		static const string EMPTY_WORD;
+		static const string TABLE_REPRESENTATION;
+		static const string BIT_PARALLEL_REPRESENTATION;
 		DFA(string name = "Nameless DFA", string description = "No description", string alphabet = "", vector<State *> states = vector<State *>());
 		DFA(ifstream & dfaJSONModelFile);
 		~DFA();
@@ -68,15 +129,34 @@ class DFA
 		void setDescription(string description);
 		void setAlphabet(string alphabet);
 		void setStates(vector<State *> states);
-		string getName();
-		string getDescription();
-		vector<State *> getStates();
-		string getAlphabet();
+		const string & getName() const;
+		const string & getDescription() const;
+		const vector<State *> & getStates() const;
+		const string & getAlphabet() const;
 		void addState(State * state);
 		bool removeState(State * state);
-		bool removeState(string name);
+		bool removeState(string_view name);
 		void preValidate();
-		DFAValidationResult validate(string input, bool deepValidation = true, bool verbose = false, int delay = DFA::NO_DELAY, ofstream * fileToPrint = NULL);
+		DFAMinimizationResult minimize();
+		void saveBinaryModel(const string & binaryModelPath);
+		static DFA * loadBinaryModel(const string & binaryModelPath);
+		static DFA * loadJFlapModel(const string & jflapModelPath, string name = "Nameless DFA", string description = "No description");
+		void saveStaticModel(ofstream & headerFile, const string & tableName);
+		void saveDirectCodedModel(ofstream & headerFile, const string & scannerName);
+		CompiledDFA * getCompiledDFA();
+		const CompiledDFA * getCompiledDFA() const;
+		void freeze();
+		bool isFrozen() const;
+		string getRepresentation() const;
+		DFAValidationResult validate(string_view input, bool deepValidation = true, bool verbose = false, int delay = DFA::NO_DELAY, ofstream * fileToPrint = NULL);
+		DFAValidationResult validate(const char * input, size_t length) const;
+		DFAValidationResult validate(string_view input) const;
+		bool accepts(const char * input, size_t length) const;
+		bool accepts(string_view input) const;
+		void validateBatch(const string_view * inputs, DFAValidationResult * results, size_t count) const;
+		void validateBatch(const vector<string_view> & inputs, vector<DFAValidationResult> & results) const;
+		DFAValidationResult validateParallel(const char * input, size_t length, int threadsCount = 0) const;
+		DFAMatchResult longestMatch(const char * begin, const char * end) const;
 		void clear();
 		void printInfo(ofstream * fileToPrint = NULL);
 		friend ostream & operator <<(ostream & output, DFA & dfa);
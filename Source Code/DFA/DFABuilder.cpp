@@ -16,25 +16,25 @@ DFABuilder::~DFABuilder()
 
 DFABuilder * DFABuilder::buildName(string name)
 {
-	this->dfa->setName(name);
+	this->dfa->setName(move(name));
 	return this;
 }
 
 DFABuilder * DFABuilder::buildDescription(string description)
 {
-	this->dfa->setDescription(description);
+	this->dfa->setDescription(move(description));
 	return this;
 }
 
 DFABuilder * DFABuilder::buildAlphabet(string alphabet)
 {
-	this->dfa->setAlphabet(alphabet);
+	this->dfa->setAlphabet(move(alphabet));
 	return this;
 }
 
 DFABuilder * DFABuilder::buildStates(vector<State *> states)
 {
-	this->dfa->setStates(states);
+	this->dfa->setStates(move(states));
 	return this;
 }
 
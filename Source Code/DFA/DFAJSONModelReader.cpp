@@ -0,0 +1,435 @@
+// DFAJSONModelReader.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "DFAJSONModelReader.h"
+
+const int DFAJSONModelReader::DOCUMENT_CONTEXT = 0;
+const int DFAJSONModelReader::MODEL_CONTEXT = 1;
+const int DFAJSONModelReader::STATES_CONTEXT = 2;
+const int DFAJSONModelReader::STATE_CONTEXT = 3;
+const int DFAJSONModelReader::TRANSITIONS_CONTEXT = 4;
+const int DFAJSONModelReader::TRANSITION_CONTEXT = 5;
+const int DFAJSONModelReader::SKIPPED_CONTEXT = 6;
+const int DFAJSONModelReader::STRING_VALUE = 0;
+const int DFAJSONModelReader::BOOL_VALUE = 1;
+const int DFAJSONModelReader::INTEGER_VALUE = 2;
+const int DFAJSONModelReader::OTHER_VALUE = 3;
+
+DFAJSONModelStream::DFAJSONModelStream(istream & input)
+{
+	this->buffer = input.rdbuf();
+	this->count = 0;
+}
+
+char DFAJSONModelStream::Peek() const
+{
+	int character = this->buffer->sgetc();
+	return ((character != EOF) ? (char)character : '\0');
+}
+
+char DFAJSONModelStream::Take()
+{
+	int character = this->buffer->sbumpc();
+	if(character == EOF)
+	{
+		return '\0';
+	}
+	this->count++;
+	return (char)character;
+}
+
+size_t DFAJSONModelStream::Tell() const
+{
+	return this->count;
+}
+
+char * DFAJSONModelStream::PutBegin()
+{
+	return NULL;
+}
+
+void DFAJSONModelStream::Put(char character)
+{
+}
+
+size_t DFAJSONModelStream::PutEnd(char * begin)
+{
+	return 0;
+}
+
+DFAJSONModelReader::DFAJSONModelReader()
+{
+	this->expectingKey = false;
+	this->boolValue = false;
+	this->integerValue = 0;
+}
+
+DFAJSONModelReader::~DFAJSONModelReader()
+{
+	for(int index = 0; index < this->states.size(); index++)
+	{
+		delete this->states[index];
+	}
+}
+
+// The first error is kept and every following event is ignored, as the rapidjson reader can not be stopped by handlers
+void DFAJSONModelReader::fail(string exceptionDescription)
+{
+	if(this->exceptionDescription.empty())
+	{
+		this->exceptionDescription = exceptionDescription;
+	}
+}
+
+bool DFAJSONModelReader::hasReadKeys(string firstKey, string secondKey, string thirdKey, string fourthKey)
+{
+	const set<string> & readKeys = this->readKeys.back();
+	return readKeys.count(firstKey) && readKeys.count(secondKey) && (thirdKey.empty() || readKeys.count(thirdKey)) && (fourthKey.empty() || readKeys.count(fourthKey));
+}
+
+void DFAJSONModelReader::readScalar(int valueType)
+{
+	int context = this->contexts.back();
+	if(!this->exceptionDescription.empty() || context == DFAJSONModelReader::SKIPPED_CONTEXT)
+	{
+		return;
+	}
+	if(context == DFAJSONModelReader::STATES_CONTEXT)
+	{
+		this->fail("State value declared using wrong type");
+		return;
+	}
+	if(context == DFAJSONModelReader::TRANSITIONS_CONTEXT)
+	{
+		this->fail("Transition value declared using wrong type");
+		return;
+	}
+	if(this->expectingKey)
+	{
+		this->key = this->stringValue;
+		this->expectingKey = false;
+		return;
+	}
+	this->expectingKey = true;
+	this->readKeys.back().insert(this->key);
+	if(context == DFAJSONModelReader::MODEL_CONTEXT)
+	{
+		if(this->key == "name" || this->key == "description" || this->key == "alphabet")
+		{
+			if(valueType != DFAJSONModelReader::STRING_VALUE)
+			{
+				this->fail("DFA name, description or alphabet values declared using wrong type");
+			}
+			else if(this->key == "name")
+			{
+				this->name = this->stringValue;
+			}
+			else if(this->key == "description")
+			{
+				this->description = this->stringValue;
+			}
+			else
+			{
+				this->alphabet = this->stringValue;
+			}
+		}
+		else if(this->key == "states")
+		{
+			this->fail("DFA states value declared using wrong type missing");
+		}
+	}
+	else if(context == DFAJSONModelReader::STATE_CONTEXT)
+	{
+		State * state = this->states.back();
+		if(this->key == "name" || this->key == "recognitionMessage")
+		{
+			if(valueType != DFAJSONModelReader::STRING_VALUE)
+			{
+				this->fail("State name, initial, final or recognitionMessage values declared using wrong type");
+			}
+			else if(this->key == "name")
+			{
+				state->setName(this->stringValue);
+			}
+			else
+			{
+				state->setRecognitionMessage(this->stringValue);
+			}
+		}
+		else if(this->key == "initial" || this->key == "final")
+		{
+			if(valueType != DFAJSONModelReader::BOOL_VALUE)
+			{
+				this->fail("State name, initial, final or recognitionMessage values declared using wrong type");
+			}
+			else if(this->key == "initial")
+			{
+				state->setInitial(this->boolValue);
+			}
+			else
+			{
+				state->setFinal(this->boolValue);
+			}
+		}
+		else if(this->key == "tag")
+		{
+			if(valueType != DFAJSONModelReader::INTEGER_VALUE || this->integerValue < 0 || this->integerValue > INT_MAX)
+			{
+				this->fail("State tag value declared using wrong type");
+			}
+			else
+			{
+				state->setTag((int)this->integerValue);
+			}
+		}
+		else if(this->key == "transitions")
+		{
+			this->fail("State transitions value declared using wrong type missing");
+		}
+	}
+	else if(context == DFAJSONModelReader::TRANSITION_CONTEXT)
+	{
+		if(this->key == "symbol" || this->key == "destination")
+		{
+			if(valueType != DFAJSONModelReader::STRING_VALUE)
+			{
+				this->fail("Transition symbol or destination values declared using wrong type");
+			}
+			else if(this->key == "symbol")
+			{
+				this->transitions.back().symbols = this->stringValue;
+			}
+			else
+			{
+				this->transitions.back().destination = this->stringValue;
+			}
+		}
+	}
+}
+
+void DFAJSONModelReader::startComposite(bool object)
+{
+	int context = this->contexts.back(), nextContext = DFAJSONModelReader::SKIPPED_CONTEXT;
+	if(!this->exceptionDescription.empty())
+	{
+		return;
+	}
+	if(context == DFAJSONModelReader::DOCUMENT_CONTEXT)
+	{
+		if(!object)
+		{
+			this->fail("DFA value declared using wrong type, only one model is allowed");
+			return;
+		}
+		nextContext = DFAJSONModelReader::MODEL_CONTEXT;
+	}
+	else if(context == DFAJSONModelReader::STATES_CONTEXT)
+	{
+		if(!object)
+		{
+			this->fail("State value declared using wrong type");
+			return;
+		}
+		nextContext = DFAJSONModelReader::STATE_CONTEXT;
+		this->states.push_back(new State("Nameless state",false,false,vector<Transition *>(),"Not recognizable"));
+	}
+	else if(context == DFAJSONModelReader::TRANSITIONS_CONTEXT)
+	{
+		DFAJSONModelTransition transition;
+		if(!object)
+		{
+			this->fail("Transition value declared using wrong type");
+			return;
+		}
+		nextContext = DFAJSONModelReader::TRANSITION_CONTEXT;
+		transition.source = this->states.size() - 1;
+		this->transitions.push_back(transition);
+	}
+	else if(context != DFAJSONModelReader::SKIPPED_CONTEXT)
+	{
+		this->readKeys.back().insert(this->key);
+		if(context == DFAJSONModelReader::MODEL_CONTEXT && this->key == "states")
+		{
+			if(object)
+			{
+				this->fail("DFA states value declared using wrong type missing");
+				return;
+			}
+			nextContext = DFAJSONModelReader::STATES_CONTEXT;
+		}
+		else if(context == DFAJSONModelReader::STATE_CONTEXT && this->key == "transitions")
+		{
+			if(object)
+			{
+				this->fail("State transitions value declared using wrong type missing");
+				return;
+			}
+			nextContext = DFAJSONModelReader::TRANSITIONS_CONTEXT;
+		}
+		else
+		{
+			// Composite values of known keys are wrong types, the ones of unknown keys are skipped
+			this->readScalar(DFAJSONModelReader::OTHER_VALUE);
+			if(!this->exceptionDescription.empty())
+			{
+				return;
+			}
+		}
+	}
+	this->contexts.push_back(nextContext);
+	this->readKeys.push_back(set<string>());
+	this->expectingKey = object;
+}
+
+void DFAJSONModelReader::endComposite()
+{
+	int context = this->contexts.back();
+	if(!this->exceptionDescription.empty())
+	{
+		return;
+	}
+	if(context == DFAJSONModelReader::MODEL_CONTEXT)
+	{
+		if(!this->hasReadKeys("name","description","alphabet"))
+		{
+			this->fail("DFA name, description or alphabet keys missing");
+		}
+		else if(!this->hasReadKeys("states","states"))
+		{
+			this->fail("DFA states key missing");
+		}
+	}
+	else if(context == DFAJSONModelReader::STATE_CONTEXT)
+	{
+		if(!this->hasReadKeys("name","initial","final","recognitionMessage"))
+		{
+			this->fail("State name, initial, final or recognitionMessage keys missing");
+		}
+		else if(!this->hasReadKeys("transitions","transitions"))
+		{
+			this->fail("State transitions key missing");
+		}
+	}
+	else if(context == DFAJSONModelReader::TRANSITION_CONTEXT)
+	{
+		if(!this->hasReadKeys("symbol","destination"))
+		{
+			this->fail("Transition symbol or destination keys missing");
+		}
+	}
+	this->contexts.pop_back();
+	this->readKeys.pop_back();
+	this->expectingKey = true;
+}
+
+bool DFAJSONModelReader::read(istream & dfaModelFile)
+{
+	DFAJSONModelStream stream(dfaModelFile);
+	Reader reader;
+	this->contexts.assign(1,DFAJSONModelReader::DOCUMENT_CONTEXT);
+	this->readKeys.assign(1,set<string>());
+	if(!reader.Parse<0>(stream,*this) && this->exceptionDescription.empty())
+	{
+		this->fail("DFA value declared using wrong type, only one model is allowed");
+	}
+	return this->exceptionDescription.empty();
+}
+
+const string & DFAJSONModelReader::getName() const
+{
+	return this->name;
+}
+
+const string & DFAJSONModelReader::getDescription() const
+{
+	return this->description;
+}
+
+const string & DFAJSONModelReader::getAlphabet() const
+{
+	return this->alphabet;
+}
+
+// The caller takes the ownership of the states
+vector<State *> DFAJSONModelReader::getStates()
+{
+	vector<State *> states;
+	states.swap(this->states);
+	return states;
+}
+
+const vector<DFAJSONModelTransition> & DFAJSONModelReader::getTransitions() const
+{
+	return this->transitions;
+}
+
+const string & DFAJSONModelReader::getExceptionDescription() const
+{
+	return this->exceptionDescription;
+}
+
+void DFAJSONModelReader::Null()
+{
+	this->readScalar(DFAJSONModelReader::OTHER_VALUE);
+}
+
+void DFAJSONModelReader::Bool(bool value)
+{
+	this->boolValue = value;
+	this->readScalar(DFAJSONModelReader::BOOL_VALUE);
+}
+
+void DFAJSONModelReader::Int(int value)
+{
+	this->integerValue = value;
+	this->readScalar(DFAJSONModelReader::INTEGER_VALUE);
+}
+
+void DFAJSONModelReader::Uint(unsigned value)
+{
+	this->integerValue = value;
+	this->readScalar(DFAJSONModelReader::INTEGER_VALUE);
+}
+
+void DFAJSONModelReader::Int64(int64_t value)
+{
+	this->integerValue = value;
+	this->readScalar(DFAJSONModelReader::INTEGER_VALUE);
+}
+
+void DFAJSONModelReader::Uint64(uint64_t value)
+{
+	this->readScalar(DFAJSONModelReader::OTHER_VALUE);
+}
+
+void DFAJSONModelReader::Double(double value)
+{
+	this->readScalar(DFAJSONModelReader::OTHER_VALUE);
+}
+
+void DFAJSONModelReader::String(const char * value, SizeType length, bool copy)
+{
+	this->stringValue.assign(value,length);
+	this->readScalar(DFAJSONModelReader::STRING_VALUE);
+}
+
+void DFAJSONModelReader::StartObject()
+{
+	this->startComposite(true);
+}
+
+void DFAJSONModelReader::EndObject(SizeType membersCount)
+{
+	this->endComposite();
+}
+
+void DFAJSONModelReader::StartArray()
+{
+	this->startComposite(false);
+}
+
+void DFAJSONModelReader::EndArray(SizeType elementsCount)
+{
+	this->endComposite();
+}
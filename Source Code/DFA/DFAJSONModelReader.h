@@ -0,0 +1,101 @@
+// DFAJSONModelReader.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __dfa_json_model_reader__
+#define __dfa_json_model_reader__
+
+#include <climits>
+#include <set>
+#include "State.h"
+#include "rapidjson/reader.h"
+
+using namespace std;
+using namespace rapidjson;
+
+typedef struct DFAJSONModelTransition
+{
+	int source;
+	string symbols;
+	string destination;
+}
+DFAJSONModelTransition;
+
+// Input stream of the rapidjson reader over a standard stream, the model is never held in memory as a whole
+class DFAJSONModelStream
+{
+	private:
+		streambuf * buffer;
+		size_t count;
+
+	public:
+		typedef char Ch;
+		DFAJSONModelStream(istream & input);
+		char Peek() const;
+		char Take();
+		size_t Tell() const;
+		char * PutBegin();
+		void Put(char character);
+		size_t PutEnd(char * begin);
+};
+
+// Builds the states of a DFA JSON model from the rapidjson events of a single pass over the stream
+// Transitions are only collected, their destinations are resolved by name once every state is known
+class DFAJSONModelReader
+{
+	private:
+		static const int DOCUMENT_CONTEXT;
+		static const int MODEL_CONTEXT;
+		static const int STATES_CONTEXT;
+		static const int STATE_CONTEXT;
+		static const int TRANSITIONS_CONTEXT;
+		static const int TRANSITION_CONTEXT;
+		static const int SKIPPED_CONTEXT;
+		static const int STRING_VALUE;
+		static const int BOOL_VALUE;
+		static const int INTEGER_VALUE;
+		static const int OTHER_VALUE;
+		string name;
+		string description;
+		string alphabet;
+		vector<State *> states;
+		vector<DFAJSONModelTransition> transitions;
+		string exceptionDescription;
+		vector<int> contexts;
+		vector< set<string> > readKeys;
+		string key;
+		bool expectingKey;
+		string stringValue;
+		bool boolValue;
+		int64_t integerValue;
+		void fail(string exceptionDescription);
+		void readScalar(int valueType);
+		void startComposite(bool object);
+		void endComposite();
+		bool hasReadKeys(string firstKey, string secondKey, string thirdKey = "", string fourthKey = "");
+
+	public:
+		DFAJSONModelReader();
+		~DFAJSONModelReader();
+		bool read(istream & dfaModelFile);
+		const string & getName() const;
+		const string & getDescription() const;
+		const string & getAlphabet() const;
+		vector<State *> getStates();
+		const vector<DFAJSONModelTransition> & getTransitions() const;
+		const string & getExceptionDescription() const;
+		void Null();
+		void Bool(bool value);
+		void Int(int value);
+		void Uint(unsigned value);
+		void Int64(int64_t value);
+		void Uint64(uint64_t value);
+		void Double(double value);
+		void String(const char * value, SizeType length, bool copy);
+		void StartObject();
+		void EndObject(SizeType membersCount);
+		void StartArray();
+		void EndArray(SizeType elementsCount);
+};
+
+#endif
@@ -0,0 +1,52 @@
+// DFAJSONToBinary.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+// Converts a DFA JSON model (or a JFLAP .jff one) into a minimized binary model, usable through DFA::loadBinaryModel
+
+#include "DFA.h"
+
+int main(int argumentsCount, char ** arguments)
+{
+	if(argumentsCount != 3)
+	{
+		cout << "Usage: " << arguments[0] << " [DFA JSON or JFLAP model path : string] [DFA binary model path : string]" << endl;
+		return EXIT_FAILURE;
+	}
+	try
+	{
+		string modelPath = arguments[1];
+		DFA * dfa;
+		DFAMinimizationResult result;
+		if(modelPath.length() > 4 && modelPath.compare(modelPath.length() - 4,4,".jff") == 0)
+		{
+			string name = modelPath.substr(0,modelPath.length() - 4);
+			dfa = DFA::loadJFlapModel(modelPath,name.substr(name.find_last_of('/') + 1),"Converted from " + modelPath);
+		}
+		else
+		{
+			ifstream dfaJSONModelFile(modelPath,ios::in);
+			dfa = new DFA(dfaJSONModelFile);
+			dfaJSONModelFile.close();
+		}
+		try
+		{
+			dfa->preValidate();
+			result = dfa->minimize();
+			dfa->saveBinaryModel(arguments[2]);
+		}
+		catch(const string exception)
+		{
+			delete dfa;
+			throw;
+		}
+		cout << dfa->getName() << ": " << result.statesBefore << " -> " << result.statesAfter << " states, " << result.transitionsBefore << " -> " << result.transitionsAfter << " transitions" << endl;
+		delete dfa;
+	}
+	catch(const string exception)
+	{
+		cout << exception << endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// DFAJSONToStatic.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+// Converts DFA JSON models into a header of constexpr tables, runnable through StaticDFA
+// Every model gets its own table and, in the given priority order, they are also merged into a combined table
+// Each table also gets a direct-coded scanner named after it (runnable through DirectCodedDFA), so both can be benchmarked
+
+#include "CombinedDFA.h"
+
+string getTableIdentifier(string name)
+{
+	for(int index = 0; index < name.length(); index++)
+	{
+		if(!isalnum(name[index]))
+		{
+			name[index] = '_';
+		}
+	}
+	return name;
+}
+
+int main(int argumentsCount, char ** arguments)
+{
+	vector<DFA *> dfas;
+	int result = EXIT_SUCCESS;
+	if(argumentsCount < 4)
+	{
+		cout << "Usage: " << arguments[0] << " [header path : string] [combined table name : string] [DFA JSON model paths : string...]" << endl;
+		return EXIT_FAILURE;
+	}
+	try
+	{
+		string combinedTableName = getTableIdentifier(arguments[2]), guard = "__" + combinedTableName + "__";
+		ofstream headerFile;
+		transform(guard.begin(),guard.end(),guard.begin(),::tolower);
+		for(int index = 3; index < argumentsCount; index++)
+		{
+			ifstream dfaJSONModelFile(arguments[index],ios::in);
+			dfas.push_back(new DFA(dfaJSONModelFile));
+			dfaJSONModelFile.close();
+			dfas.back()->preValidate();
+			dfas.back()->minimize();
+		}
+		headerFile.open(arguments[1],ios::out | ios::trunc);
+		if(!headerFile.good())
+		{
+			throw string("Could not write ") + arguments[1];
+		}
+		headerFile << "// Generated by DFAJSONToStatic, do not edit" << endl << endl;
+		headerFile << "#ifndef " << guard << endl << "#define " << guard << endl << endl;
+		for(int index = 0; index < dfas.size(); index++)
+		{
+			dfas[index]->saveStaticModel(headerFile,getTableIdentifier(dfas[index]->getName()));
+			dfas[index]->saveDirectCodedModel(headerFile,getTableIdentifier(dfas[index]->getName()) + "Scanner");
+		}
+		CombinedDFA combinedDFA(dfas);
+		combinedDFA.saveStaticModel(headerFile,combinedTableName);
+		combinedDFA.saveDirectCodedModel(headerFile,combinedTableName + "Scanner");
+		headerFile << "#endif" << endl;
+		headerFile.close();
+	}
+	catch(const string exception)
+	{
+		cout << exception << endl;
+		result = EXIT_FAILURE;
+	}
+	for(int index = 0; index < dfas.size(); index++)
+	{
+		delete dfas[index];
+	}
+	return result;
+}
@@ -0,0 +1,63 @@
+// DFAMatcher.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "DFAMatcher.h"
+
+DFAMatcher::DFAMatcher(const DFA * dfa)
+{
+	this->compiledDFA = dfa->getCompiledDFA();
+	this->reset();
+}
+
+DFAMatcher::~DFAMatcher()
+{
+	this->compiledDFA = NULL;
+}
+
+int DFAMatcher::getCurrentState()
+{
+	return this->currentState;
+}
+
+size_t DFAMatcher::getConsumedLength()
+{
+	return this->consumedLength;
+}
+
+bool DFAMatcher::isDead()
+{
+	return this->currentState == CompiledDFA::ERROR_STATE_INDEX;
+}
+
+bool DFAMatcher::feed(const char * input, size_t length)
+{
+	if(!this->isDead())
+	{
+		this->currentState = this->compiledDFA->run(this->currentState,input,length);
+		this->consumedLength += length;
+	}
+	return !this->isDead();
+}
+
+bool DFAMatcher::feed(string_view input)
+{
+	return this->feed(input.data(),input.length());
+}
+
+DFAValidationResult DFAMatcher::finish()
+{
+	DFAValidationResult result;
+	initializeDFAValidationResult(result);
+	setValidToDFAValidationResult(result,this->compiledDFA->isFinal(this->currentState));
+	setCurrentStateToDFAValidationResult(result,this->compiledDFA->getState(this->currentState));
+	setStateIdToDFAValidationResult(result,this->currentState);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(this->currentState));
+	return result;
+}
+
+void DFAMatcher::reset()
+{
+	this->currentState = this->compiledDFA->getInitialState();
+	this->consumedLength = 0;
+}
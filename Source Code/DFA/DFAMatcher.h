@@ -0,0 +1,33 @@
+// DFAMatcher.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __dfa_matcher__
+#define __dfa_matcher__
+
+#include "DFA.h"
+
+using namespace std;
+
+// Matches an input given in chunks against a frozen DFA, keeping the current state between them
+// The table of the DFA is borrowed, so the DFA must stay alive and frozen (not modified) as long as the DFAMatcher is used
+class DFAMatcher
+{
+	private:
+		const CompiledDFA * compiledDFA;
+		int currentState;
+		size_t consumedLength;
+
+	public:
+		DFAMatcher(const DFA * dfa);
+		~DFAMatcher();
+		int getCurrentState();
+		size_t getConsumedLength();
+		bool isDead();
+		bool feed(const char * input, size_t length);
+		bool feed(string_view input);
+		DFAValidationResult finish();
+		void reset();
+};
+
+#endif
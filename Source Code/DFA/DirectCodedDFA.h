@@ -0,0 +1,45 @@
+// DirectCodedDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __direct_coded_dfa__
+#define __direct_coded_dfa__
+
+#include "StaticDFA.h"
+
+using namespace std;
+
+// Runs a direct-coded scanner generated by DFAJSONToStatic, which provides STATES_COUNT, RECOGNIZERS and
+// FINAL_STATE_TAGS as constexpr members and a run function, the results match the ones of StaticDFA
+template <typename Scanner>
+class DirectCodedDFA
+{
+	public:
+		static constexpr int ERROR_STATE_INDEX = -1;
+		static constexpr int NO_RECOGNIZER = -1;
+
+		static bool accepts(const char * input, size_t length)
+		{
+			int currentState = Scanner::run(input,length);
+			return currentState != DirectCodedDFA::ERROR_STATE_INDEX && Scanner::RECOGNIZERS[currentState] != DirectCodedDFA::NO_RECOGNIZER;
+		}
+
+		static StaticDFAValidationResult validate(string_view input)
+		{
+			StaticDFAValidationResult result = {false,Scanner::run(input.data(),input.length()),DirectCodedDFA::NO_RECOGNIZER,DirectCodedDFA::NO_RECOGNIZER};
+			result.valid = result.state != DirectCodedDFA::ERROR_STATE_INDEX && Scanner::RECOGNIZERS[result.state] != DirectCodedDFA::NO_RECOGNIZER;
+			result.recognizer = ((result.valid) ? Scanner::RECOGNIZERS[result.state] : DirectCodedDFA::NO_RECOGNIZER);
+			result.tag = ((result.valid) ? Scanner::FINAL_STATE_TAGS[result.state] : DirectCodedDFA::NO_RECOGNIZER);
+			return result;
+		}
+
+		static void validateBatch(const string_view * inputs, StaticDFAValidationResult * results, size_t count)
+		{
+			for(size_t index = 0; index < count; index++)
+			{
+				results[index] = DirectCodedDFA::validate(inputs[index]);
+			}
+		}
+};
+
+#endif
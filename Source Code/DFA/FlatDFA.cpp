@@ -0,0 +1,159 @@
+// FlatDFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "FlatDFA.h"
+
+const int FlatDFA::ERROR_STATE_INDEX = -1;
+
+void initializeFlatDFAValidationResult(FlatDFAValidationResult & flatDFAValidationResult)
+{
+	flatDFAValidationResult.valid = false;
+	flatDFAValidationResult.stateId = FlatDFA::ERROR_STATE_INDEX;
+	flatDFAValidationResult.tag = State::NO_TAG;
+}
+
+FlatDFA::FlatDFA(DFA * dfa)
+{
+	map<State *,int> indexes;
+	size_t transitionsSize;
+	int transitionIndex = 0;
+
+	// Only valid DFAs are converted, getCompiledDFA throws otherwise
+	dfa->getCompiledDFA();
+	const vector<State *> & states = dfa->getStates();
+	this->statesCount = states.size();
+	this->transitionsCount = 0;
+	this->initialState = FlatDFA::ERROR_STATE_INDEX;
+	for(int index = 0; index < this->statesCount; index++)
+	{
+		const vector<Transition *> & transitions = states[index]->getTransitions();
+		indexes[states[index]] = index;
+		for(int stateTransition = 0; stateTransition < transitions.size(); stateTransition++)
+		{
+			if(transitions[stateTransition]->getDestination() != State::ERROR_STATE)
+			{
+				this->transitionsCount++;
+			}
+		}
+	}
+
+	// Transitions go first in the arena as they have the strictest alignment
+	transitionsSize = this->transitionsCount * sizeof(FlatDFATransition);
+	this->arena = new unsigned char[transitionsSize + this->statesCount * sizeof(FlatDFAState)];
+	this->transitions = (FlatDFATransition *)this->arena;
+	this->states = (FlatDFAState *)(this->arena + transitionsSize);
+	for(int index = 0; index < this->statesCount; index++)
+	{
+		const vector<Transition *> & transitions = states[index]->getTransitions();
+		FlatDFAState * currentState = new (&this->states[index]) FlatDFAState();
+		currentState->firstTransition = transitionIndex;
+		currentState->transitionsCount = 0;
+		currentState->tag = states[index]->getTag();
+		currentState->initial = states[index]->isInitial();
+		currentState->final = states[index]->isFinal();
+		if(currentState->initial && this->initialState == FlatDFA::ERROR_STATE_INDEX)
+		{
+			this->initialState = index;
+		}
+		for(int stateTransition = 0; stateTransition < transitions.size(); stateTransition++)
+		{
+			if(transitions[stateTransition]->getDestination() != State::ERROR_STATE)
+			{
+				FlatDFATransition * currentTransition = new (&this->transitions[transitionIndex++]) FlatDFATransition();
+				currentTransition->symbols = transitions[stateTransition]->getSymbolSet();
+				currentTransition->destination = indexes[transitions[stateTransition]->getDestination()];
+				currentState->transitionsCount++;
+			}
+		}
+	}
+}
+
+FlatDFA::~FlatDFA()
+{
+	this->clear();
+}
+
+int FlatDFA::getStatesCount() const
+{
+	return this->statesCount;
+}
+
+int FlatDFA::getTransitionsCount() const
+{
+	return this->transitionsCount;
+}
+
+int FlatDFA::getInitialState() const
+{
+	return this->initialState;
+}
+
+const FlatDFAState * FlatDFA::getStates() const
+{
+	return this->states;
+}
+
+const FlatDFATransition * FlatDFA::getTransitions() const
+{
+	return this->transitions;
+}
+
+int FlatDFA::getNextState(int state, char symbol) const
+{
+	const FlatDFATransition * transition = this->transitions + this->states[state].firstTransition;
+	const FlatDFATransition * end = transition + this->states[state].transitionsCount;
+	for(; transition != end; transition++)
+	{
+		if(transition->symbols.test((unsigned char)symbol))
+		{
+			return transition->destination;
+		}
+	}
+	return FlatDFA::ERROR_STATE_INDEX;
+}
+
+bool FlatDFA::isFinal(int state) const
+{
+	return state != FlatDFA::ERROR_STATE_INDEX && this->states[state].final;
+}
+
+int FlatDFA::getTag(int state) const
+{
+	return ((state != FlatDFA::ERROR_STATE_INDEX) ? this->states[state].tag : State::NO_TAG);
+}
+
+int FlatDFA::run(const char * input, size_t length) const
+{
+	int currentState = this->initialState;
+	for(size_t index = 0; index < length && currentState != FlatDFA::ERROR_STATE_INDEX; index++)
+	{
+		currentState = this->getNextState(currentState,input[index]);
+	}
+	return currentState;
+}
+
+FlatDFAValidationResult FlatDFA::validate(const char * input, size_t length) const
+{
+	FlatDFAValidationResult result;
+	result.stateId = this->run(input,length);
+	result.valid = this->isFinal(result.stateId);
+	result.tag = this->getTag(result.stateId);
+	return result;
+}
+
+FlatDFAValidationResult FlatDFA::validate(string_view input) const
+{
+	return this->validate(input.data(),input.length());
+}
+
+void FlatDFA::clear()
+{
+	delete [] this->arena;
+	this->arena = NULL;
+	this->transitions = NULL;
+	this->states = NULL;
+	this->statesCount = 0;
+	this->transitionsCount = 0;
+	this->initialState = FlatDFA::ERROR_STATE_INDEX;
+}
@@ -0,0 +1,69 @@
+// FlatDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __flat_dfa__
+#define __flat_dfa__
+
+#include <new>
+#include "DFA.h"
+
+using namespace std;
+
+typedef struct FlatDFAState
+{
+	int firstTransition;
+	int transitionsCount;
+	int tag;
+	bool initial;
+	bool final;
+}
+FlatDFAState;
+
+typedef struct FlatDFATransition
+{
+	SymbolSet symbols;
+	int destination;
+}
+FlatDFATransition;
+
+typedef struct FlatDFAValidationResult
+{
+	bool valid;
+	int stateId;
+	int tag;
+}
+FlatDFAValidationResult;
+
+void initializeFlatDFAValidationResult(FlatDFAValidationResult & flatDFAValidationResult);
+
+// States and transitions of a DFA laid out in a single arena, transitions of a state are contiguous and indexed
+class FlatDFA
+{
+	private:
+		int statesCount;
+		int transitionsCount;
+		int initialState;
+		unsigned char * arena;
+		FlatDFATransition * transitions;
+		FlatDFAState * states;
+
+	public:
+		static const int ERROR_STATE_INDEX;
+		FlatDFA(DFA * dfa);
+		~FlatDFA();
+		int getStatesCount() const;
+		int getTransitionsCount() const;
+		int getInitialState() const;
+		const FlatDFAState * getStates() const;
+		const FlatDFATransition * getTransitions() const;
+		int getNextState(int state, char symbol) const;
+		bool isFinal(int state) const;
+		int getTag(int state) const;
+		int run(const char * input, size_t length) const;
+		FlatDFAValidationResult validate(const char * input, size_t length) const;
+		FlatDFAValidationResult validate(string_view input) const;
+		void clear();
+};
+
+#endif
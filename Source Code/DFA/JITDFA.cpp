@@ -0,0 +1,181 @@
+// JITDFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "JITDFA.h"
+
+JITDFA::JITDFA(const DFA * dfa)
+{
+	this->compiledDFA = dfa->getCompiledDFA();
+	this->code = NULL;
+	this->codeSize = 0;
+	this->function = NULL;
+	this->compile();
+}
+
+JITDFA::~JITDFA()
+{
+	this->clear();
+}
+
+void JITDFA::emitInteger(vector<unsigned char> & code, int value)
+{
+	for(int byte = 0; byte < 4; byte++)
+	{
+		code.push_back((unsigned char)(((unsigned int)value >> (8 * byte)) & 0xFF));
+	}
+}
+
+// Emits, with rdi as the cursor and rsi as the end of the input, for every state k:
+// return_k: mov eax,k; ret
+// state_k: cmp rdi,rsi; je return_k; movzx eax,byte [rdi]; inc rdi; (compare the symbol ranges and jump); mov eax,-1; ret
+void JITDFA::compile()
+{
+#if defined(__x86_64__) && !defined(_WIN32)
+	vector<unsigned char> code;
+	vector<size_t> stateOffsets(this->compiledDFA->getStatesCount());
+	vector< pair<size_t,int> > jumps;
+	int statesCount = this->compiledDFA->getStatesCount(), initialState = this->compiledDFA->getInitialState();
+	void * memory;
+	if(initialState == CompiledDFA::ERROR_STATE_INDEX)
+	{
+		code.push_back(0xB8);
+		JITDFA::emitInteger(code,CompiledDFA::ERROR_STATE_INDEX);
+		code.push_back(0xC3);
+	}
+	else
+	{
+		// add rsi,rdi; jmp state_initial
+		code.push_back(0x48);
+		code.push_back(0x01);
+		code.push_back(0xFE);
+		code.push_back(0xE9);
+		jumps.push_back(make_pair(code.size(),initialState));
+		JITDFA::emitInteger(code,0);
+		for(int state = 0; state < statesCount; state++)
+		{
+			size_t returnOffset = code.size();
+			code.push_back(0xB8);
+			JITDFA::emitInteger(code,state);
+			code.push_back(0xC3);
+			stateOffsets[state] = code.size();
+			code.push_back(0x48);
+			code.push_back(0x39);
+			code.push_back(0xF7);
+			code.push_back(0x0F);
+			code.push_back(0x84);
+			JITDFA::emitInteger(code,(int)(returnOffset - (code.size() + 4)));
+			code.push_back(0x0F);
+			code.push_back(0xB6);
+			code.push_back(0x07);
+			code.push_back(0x48);
+			code.push_back(0xFF);
+			code.push_back(0xC7);
+			for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT;)
+			{
+				int destination = this->compiledDFA->getNextState(state,(char)symbol), lastSymbol = symbol;
+				while(lastSymbol + 1 < CompiledDFA::SYMBOLS_COUNT && this->compiledDFA->getNextState(state,(char)(lastSymbol + 1)) == destination)
+				{
+					lastSymbol++;
+				}
+				if(destination != CompiledDFA::ERROR_STATE_INDEX)
+				{
+					if(symbol == lastSymbol)
+					{
+						// cmp al,symbol; je state_destination
+						code.push_back(0x3C);
+						code.push_back((unsigned char)symbol);
+						code.push_back(0x0F);
+						code.push_back(0x84);
+					}
+					else
+					{
+						// mov ecx,eax; sub ecx,symbol; cmp ecx,lastSymbol-symbol; jbe state_destination
+						code.push_back(0x89);
+						code.push_back(0xC1);
+						code.push_back(0x81);
+						code.push_back(0xE9);
+						JITDFA::emitInteger(code,symbol);
+						code.push_back(0x81);
+						code.push_back(0xF9);
+						JITDFA::emitInteger(code,lastSymbol - symbol);
+						code.push_back(0x0F);
+						code.push_back(0x86);
+					}
+					jumps.push_back(make_pair(code.size(),destination));
+					JITDFA::emitInteger(code,0);
+				}
+				symbol = lastSymbol + 1;
+			}
+			code.push_back(0xB8);
+			JITDFA::emitInteger(code,CompiledDFA::ERROR_STATE_INDEX);
+			code.push_back(0xC3);
+		}
+		for(int index = 0; index < jumps.size(); index++)
+		{
+			int displacement = (int)(stateOffsets[jumps[index].second] - (jumps[index].first + 4));
+			memcpy(&code[jumps[index].first],&displacement,sizeof(displacement));
+		}
+	}
+
+	// The page is written first and only then made executable
+	memory = mmap(NULL,code.size(),PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+	if(memory == MAP_FAILED)
+	{
+		return;
+	}
+	memcpy(memory,code.data(),code.size());
+	if(mprotect(memory,code.size(),PROT_READ | PROT_EXEC) != 0)
+	{
+		munmap(memory,code.size());
+		return;
+	}
+	this->code = memory;
+	this->codeSize = code.size();
+	this->function = (JITDFAFunction)memory;
+#endif
+}
+
+bool JITDFA::isNative() const
+{
+	return this->function != NULL;
+}
+
+size_t JITDFA::getCodeSize() const
+{
+	return this->codeSize;
+}
+
+int JITDFA::run(const char * input, size_t length) const
+{
+	return ((this->function != NULL) ? this->function(input,length) : this->compiledDFA->run(input,length));
+}
+
+DFAValidationResult JITDFA::validate(const char * input, size_t length) const
+{
+	DFAValidationResult result;
+	int currentStateIndex = this->run(input,length);
+	initializeDFAValidationResult(result);
+	setValidToDFAValidationResult(result,this->compiledDFA->isFinal(currentStateIndex));
+	setCurrentStateToDFAValidationResult(result,this->compiledDFA->getState(currentStateIndex));
+	setStateIdToDFAValidationResult(result,currentStateIndex);
+	setTagToDFAValidationResult(result,this->compiledDFA->getTag(currentStateIndex));
+	return result;
+}
+
+DFAValidationResult JITDFA::validate(string_view input) const
+{
+	return this->validate(input.data(),input.length());
+}
+
+void JITDFA::clear()
+{
+	if(this->code != NULL)
+	{
+		munmap(this->code,this->codeSize);
+	}
+	this->code = NULL;
+	this->codeSize = 0;
+	this->function = NULL;
+	this->compiledDFA = NULL;
+}
@@ -0,0 +1,38 @@
+// JITDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __jit_dfa__
+#define __jit_dfa__
+
+#include "DFA.h"
+
+using namespace std;
+
+typedef int (* JITDFAFunction)(const char * input, size_t length);
+
+// Compiles a frozen DFA into native code at runtime, every state becomes a block of compares and jumps
+// Only x86-64 System V targets are compiled, other targets (or a failed compilation) run the compiled table instead
+// The table of the DFA is borrowed, so the DFA must stay alive and frozen (not modified) as long as the JITDFA is used
+class JITDFA
+{
+	private:
+		const CompiledDFA * compiledDFA;
+		void * code;
+		size_t codeSize;
+		JITDFAFunction function;
+		void compile();
+		static void emitInteger(vector<unsigned char> & code, int value);
+
+	public:
+		JITDFA(const DFA * dfa);
+		~JITDFA();
+		bool isNative() const;
+		size_t getCodeSize() const;
+		int run(const char * input, size_t length) const;
+		DFAValidationResult validate(const char * input, size_t length) const;
+		DFAValidationResult validate(string_view input) const;
+		void clear();
+};
+
+#endif
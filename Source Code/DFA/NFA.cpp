@@ -0,0 +1,323 @@
+// NFA.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "NFA.h"
+
+const string NFA::INVALID_NFA_EXCEPTION = "Invalid NFA";
+const int NFA::ERROR_STATE_INDEX = -1;
+const int NFA::UNKNOWN_STATE_INDEX = -2;
+const size_t NFA::DEFAULT_CACHE_SIZE = 1 << 20;
+
+void initializeNFAValidationResult(NFAValidationResult & nfaValidationResult)
+{
+	nfaValidationResult.valid = false;
+	nfaValidationResult.tag = State::NO_TAG;
+}
+
+// The JSON model has the DFA format, only states may have several transitions on a symbol and the empty word as a symbol
+NFA::NFA(ifstream & nfaJSONModelFile, size_t cacheSize)
+{
+	DFA model(nfaJSONModelFile);
+	this->name = model.getName();
+	this->alphabet = model.getAlphabet();
+	this->cacheSize = cacheSize;
+	this->usedCacheSize = 0;
+	this->flushesCount = 0;
+	this->build(model.getStates());
+}
+
+NFA::NFA(string name, string alphabet, vector<State *> states, size_t cacheSize)
+{
+	this->name = move(name);
+	this->alphabet = move(alphabet);
+	this->cacheSize = cacheSize;
+	this->usedCacheSize = 0;
+	this->flushesCount = 0;
+	this->build(states);
+}
+
+NFA::~NFA()
+{
+	this->clear();
+}
+
+void NFA::build(const vector<State *> & states)
+{
+	map<State *,int> indexes;
+	SymbolSet alphabetSymbols;
+	for(int index = 0; index < this->alphabet.length(); index++)
+	{
+		alphabetSymbols.set((unsigned char)this->alphabet[index]);
+	}
+	for(int index = 0; index < states.size(); index++)
+	{
+		indexes[states[index]] = index;
+	}
+	for(int index = 0; index < states.size(); index++)
+	{
+		const vector<Transition *> & transitions = states[index]->getTransitions();
+		NFAState state;
+		state.final = states[index]->isFinal();
+		state.tag = states[index]->getTag();
+		if(states[index]->isInitial())
+		{
+			this->initialStates.push_back(index);
+		}
+		for(int transitionIndex = 0; transitionIndex < transitions.size(); transitionIndex++)
+		{
+			map<State *,int>::iterator destination = indexes.find(transitions[transitionIndex]->getDestination());
+			NFATransition transition;
+			if(destination == indexes.end())
+			{
+				if(transitions[transitionIndex]->getDestination() == State::ERROR_STATE)
+				{
+					continue;
+				}
+				throw NFA::INVALID_NFA_EXCEPTION + ": transitions have unrelated source or destination states";
+			}
+			transition.symbols = transitions[transitionIndex]->getSymbolSet();
+			transition.destination = destination->second;
+			// The empty word was split from the symbols when the transition was added, so an empty word transition has no symbols
+			if(transitions[transitionIndex]->hasEmptyWord())
+			{
+				state.emptyTransitions.push_back(transition.destination);
+			}
+			if((transition.symbols & ~alphabetSymbols).any())
+			{
+				throw NFA::INVALID_NFA_EXCEPTION + ": transitions have symbols that do not belong to the alphabet";
+			}
+			if(transition.symbols.any())
+			{
+				state.transitions.push_back(transition);
+			}
+		}
+		this->states.push_back(state);
+	}
+
+	// Symbols taken by exactly the same transitions share a class, so cached states only keep a row of classes
+	this->symbolClasses.assign(CompiledDFA::SYMBOLS_COUNT,0);
+	this->classesCount = 1;
+	for(int index = 0; index < this->states.size(); index++)
+	{
+		for(int transitionIndex = 0; transitionIndex < this->states[index].transitions.size(); transitionIndex++)
+		{
+			map<pair<int,bool>,int> refinedClasses;
+			const SymbolSet & symbols = this->states[index].transitions[transitionIndex].symbols;
+			for(int symbol = 0; symbol < CompiledDFA::SYMBOLS_COUNT; symbol++)
+			{
+				pair<int,bool> key = make_pair((int)this->symbolClasses[symbol],symbols.test(symbol));
+				map<pair<int,bool>,int>::iterator refinedClass = refinedClasses.find(key);
+				if(refinedClass == refinedClasses.end())
+				{
+					refinedClass = refinedClasses.insert(make_pair(key,(int)refinedClasses.size())).first;
+				}
+				this->symbolClasses[symbol] = (unsigned char)refinedClass->second;
+			}
+			this->classesCount = refinedClasses.size();
+		}
+	}
+
+	// Sets up the initial cached state, which is not counted as a flush
+	this->flushCache();
+	this->flushesCount = 0;
+}
+
+// Extends the set with every state reachable through empty word transitions and sorts it
+void NFA::computeClosure(vector<int> & states) const
+{
+	vector<bool> visited(this->states.size(),false);
+	vector<int> closure;
+	for(int index = 0; index < states.size(); index++)
+	{
+		if(!visited[states[index]])
+		{
+			visited[states[index]] = true;
+			closure.push_back(states[index]);
+		}
+	}
+	for(int index = 0; index < closure.size(); index++)
+	{
+		const vector<int> & emptyTransitions = this->states[closure[index]].emptyTransitions;
+		for(int transitionIndex = 0; transitionIndex < emptyTransitions.size(); transitionIndex++)
+		{
+			if(!visited[emptyTransitions[transitionIndex]])
+			{
+				visited[emptyTransitions[transitionIndex]] = true;
+				closure.push_back(emptyTransitions[transitionIndex]);
+			}
+		}
+	}
+	sort(closure.begin(),closure.end());
+	states.swap(closure);
+}
+
+// Row of transitions plus the set, stored both in the index and in the list of cached states
+size_t NFA::getCachedStateSize(const vector<int> & states) const
+{
+	return this->classesCount * sizeof(int) + 2 * states.size() * sizeof(int) + sizeof(unsigned char) + sizeof(int);
+}
+
+int NFA::addCachedState(const vector<int> & states)
+{
+	map<vector<int>,int>::iterator cachedState;
+	int index = this->cachedStates.size(), tag = State::NO_TAG;
+	bool final = false;
+	if(states.empty())
+	{
+		return NFA::ERROR_STATE_INDEX;
+	}
+	cachedState = this->cachedStatesIndexes.find(states);
+	if(cachedState != this->cachedStatesIndexes.end())
+	{
+		return cachedState->second;
+	}
+
+	// Final sets take the lowest tag among their final states, like the earliest rule of a lexer specification
+	for(int stateIndex = 0; stateIndex < states.size(); stateIndex++)
+	{
+		const NFAState & state = this->states[states[stateIndex]];
+		if(state.final)
+		{
+			final = true;
+			if(state.tag != State::NO_TAG && (tag == State::NO_TAG || state.tag < tag))
+			{
+				tag = state.tag;
+			}
+		}
+	}
+	this->cachedStatesIndexes[states] = index;
+	this->cachedStates.push_back(states);
+	this->cachedTransitions.resize(this->cachedTransitions.size() + this->classesCount,NFA::UNKNOWN_STATE_INDEX);
+	this->cachedFinals.push_back(final);
+	this->cachedTags.push_back(tag);
+	this->usedCacheSize += this->getCachedStateSize(states);
+	return index;
+}
+
+int NFA::getNextState(int state, unsigned char symbol)
+{
+	int symbolClass = this->symbolClasses[symbol], nextState = this->cachedTransitions[state * this->classesCount + symbolClass];
+	vector<int> destinations;
+	if(nextState != NFA::UNKNOWN_STATE_INDEX)
+	{
+		return nextState;
+	}
+	for(int stateIndex = 0; stateIndex < this->cachedStates[state].size(); stateIndex++)
+	{
+		const vector<NFATransition> & transitions = this->states[this->cachedStates[state][stateIndex]].transitions;
+		for(int transitionIndex = 0; transitionIndex < transitions.size(); transitionIndex++)
+		{
+			if(transitions[transitionIndex].symbols.test(symbol))
+			{
+				destinations.push_back(transitions[transitionIndex].destination);
+			}
+		}
+	}
+	this->computeClosure(destinations);
+
+	// A full cache is flushed before growing, only the current state is brought back as it is still needed
+	if(!destinations.empty() && this->cachedStatesIndexes.find(destinations) == this->cachedStatesIndexes.end() && this->usedCacheSize + this->getCachedStateSize(destinations) > this->cacheSize)
+	{
+		vector<int> currentStates = this->cachedStates[state];
+		this->flushCache();
+		state = this->addCachedState(currentStates);
+	}
+	nextState = this->addCachedState(destinations);
+	this->cachedTransitions[state * this->classesCount + symbolClass] = nextState;
+	return nextState;
+}
+
+const string & NFA::getName() const
+{
+	return this->name;
+}
+
+const string & NFA::getAlphabet() const
+{
+	return this->alphabet;
+}
+
+int NFA::getStatesCount() const
+{
+	return this->states.size();
+}
+
+int NFA::getClassesCount() const
+{
+	return this->classesCount;
+}
+
+int NFA::getCachedStatesCount() const
+{
+	return this->cachedStates.size();
+}
+
+size_t NFA::getUsedCacheSize() const
+{
+	return this->usedCacheSize;
+}
+
+int NFA::getFlushesCount() const
+{
+	return this->flushesCount;
+}
+
+int NFA::run(const char * input, size_t length)
+{
+	int currentState = this->initialCachedState;
+	for(size_t index = 0; index < length && currentState != NFA::ERROR_STATE_INDEX; index++)
+	{
+		currentState = this->getNextState(currentState,(unsigned char)input[index]);
+	}
+	return currentState;
+}
+
+NFAValidationResult NFA::validate(const char * input, size_t length)
+{
+	NFAValidationResult result;
+	int currentState = this->run(input,length);
+	initializeNFAValidationResult(result);
+	if(currentState != NFA::ERROR_STATE_INDEX)
+	{
+		result.valid = this->cachedFinals[currentState];
+		result.tag = this->cachedTags[currentState];
+	}
+	return result;
+}
+
+NFAValidationResult NFA::validate(string_view input)
+{
+	return this->validate(input.data(),input.length());
+}
+
+void NFA::flushCache()
+{
+	vector<int> initialStates = this->initialStates;
+	this->cachedStatesIndexes.clear();
+	this->cachedStates.clear();
+	this->cachedTransitions.clear();
+	this->cachedFinals.clear();
+	this->cachedTags.clear();
+	this->usedCacheSize = 0;
+	this->flushesCount++;
+	this->computeClosure(initialStates);
+	this->initialCachedState = this->addCachedState(initialStates);
+}
+
+void NFA::clear()
+{
+	this->name.clear();
+	this->alphabet.clear();
+	this->states.clear();
+	this->initialStates.clear();
+	this->symbolClasses.clear();
+	this->classesCount = 0;
+	this->cachedStatesIndexes.clear();
+	this->cachedStates.clear();
+	this->cachedTransitions.clear();
+	this->cachedFinals.clear();
+	this->cachedTags.clear();
+	this->usedCacheSize = 0;
+	this->initialCachedState = NFA::ERROR_STATE_INDEX;
+}
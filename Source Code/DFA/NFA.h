@@ -0,0 +1,86 @@
+// NFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __nfa__
+#define __nfa__
+
+#include "DFA.h"
+
+using namespace std;
+
+typedef struct NFATransition
+{
+	SymbolSet symbols;
+	int destination;
+}
+NFATransition;
+
+typedef struct NFAState
+{
+	vector<NFATransition> transitions;
+	vector<int> emptyTransitions;
+	bool final;
+	int tag;
+}
+NFAState;
+
+typedef struct NFAValidationResult
+{
+	bool valid;
+	int tag;
+}
+NFAValidationResult;
+
+void initializeNFAValidationResult(NFAValidationResult & nfaValidationResult);
+
+// Nondeterministic automaton (empty word transitions included) determinized lazily while matching
+// DFA states are sets of NFA states built on demand and kept in a cache that is flushed whenever it outgrows its size
+// Matching updates the cache, so an NFA must not be shared between threads
+class NFA
+{
+	private:
+		static const string INVALID_NFA_EXCEPTION;
+		string name;
+		string alphabet;
+		vector<NFAState> states;
+		vector<int> initialStates;
+		vector<unsigned char> symbolClasses;
+		int classesCount;
+		size_t cacheSize;
+		size_t usedCacheSize;
+		int flushesCount;
+		int initialCachedState;
+		map<vector<int>,int> cachedStatesIndexes;
+		vector< vector<int> > cachedStates;
+		vector<int> cachedTransitions;
+		vector<unsigned char> cachedFinals;
+		vector<int> cachedTags;
+		void build(const vector<State *> & states);
+		void computeClosure(vector<int> & states) const;
+		size_t getCachedStateSize(const vector<int> & states) const;
+		int addCachedState(const vector<int> & states);
+		int getNextState(int state, unsigned char symbol);
+
+	public:
+		static const int ERROR_STATE_INDEX;
+		static const int UNKNOWN_STATE_INDEX;
+		static const size_t DEFAULT_CACHE_SIZE;
+		NFA(ifstream & nfaJSONModelFile, size_t cacheSize = NFA::DEFAULT_CACHE_SIZE);
+		NFA(string name, string alphabet, vector<State *> states, size_t cacheSize = NFA::DEFAULT_CACHE_SIZE);
+		~NFA();
+		const string & getName() const;
+		const string & getAlphabet() const;
+		int getStatesCount() const;
+		int getClassesCount() const;
+		int getCachedStatesCount() const;
+		size_t getUsedCacheSize() const;
+		int getFlushesCount() const;
+		int run(const char * input, size_t length);
+		NFAValidationResult validate(const char * input, size_t length);
+		NFAValidationResult validate(string_view input);
+		void flushCache();
+		void clear();
+};
+
+#endif
@@ -3,18 +3,23 @@
 // MIT license
 
 #include "State.h"
+#include "DFA.h"
 
 const State * State::ERROR_STATE = NULL;
 const string State::ERROR_STATE_NAME = "ERROR";
 const int State::EQUAL_STRINGS = 0;
+const int State::NO_ID = -1;
+const int State::NO_TAG = -1;
 
 State::State(string name, bool initial, bool final, vector<Transition *> transitions, string recognitionMessage)
 {
-	this->name = name;
+	this->name = move(name);
+	this->id = State::NO_ID;
+	this->tag = State::NO_TAG;
 	this->initial = initial;
 	this->final = final;
-	this->transitions = transitions;
-	this->recognitionMessage = recognitionMessage;
+	this->transitions = move(transitions);
+	this->recognitionMessage = move(recognitionMessage);
 }
 
 State::~State()
@@ -29,37 +34,39 @@ string State::getInfo()
 	stringStream << "\t name: " << this->name << endl;
 	stringStream << "\t initial: " << ((this->initial) ? "yes" : "no") << endl;
 	stringStream << "\t final: " << ((this->final) ? "yes" : "no") << endl;
+	stringStream << "\t tag: " << ((this->hasTag()) ? to_string(this->tag) : "none") << endl;
 	stringStream << "\t transitions: " << ((this->transitions.size() > 0) ? "" : "none");
 	for(int index = 0; index < this->transitions.size(); index++)
 	{
+		string symbols = this->transitions[index]->getSymbols();
 		if(index != this->transitions.size() - 1)
 		{
-			stringStream << "{" << ((this->transitions[index]->getSymbols().length() > 0) ? "{" : "none");
-			for(int letterIndex = 0; letterIndex < this->transitions[index]->getSymbols().length(); letterIndex++)
+			stringStream << "{" << ((symbols.length() > 0) ? "{" : "none");
+			for(int letterIndex = 0; letterIndex < symbols.length(); letterIndex++)
 			{
-				if(letterIndex != this->transitions[index]->getSymbols().length() - 1)
+				if(letterIndex != symbols.length() - 1)
 				{
-					stringStream << this->transitions[index]->getSymbols()[letterIndex] << ",";
+					stringStream << symbols[letterIndex] << ",";
 				}
 				else
 				{
-					stringStream << this->transitions[index]->getSymbols()[letterIndex] << "},";
+					stringStream << symbols[letterIndex] << "},";
 				}
 			}
 			stringStream << ((this->transitions[index]->getDestination() != State::ERROR_STATE) ? this->transitions[index]->getDestination()->getName() : State::ERROR_STATE_NAME) << "}, ";
 		}
 		else
 		{
-			stringStream << "{" << ((this->transitions[index]->getSymbols().length() > 0) ? "{" : "none");
-			for(int letterIndex = 0; letterIndex < this->transitions[index]->getSymbols().length(); letterIndex++)
+			stringStream << "{" << ((symbols.length() > 0) ? "{" : "none");
+			for(int letterIndex = 0; letterIndex < symbols.length(); letterIndex++)
 			{
-				if(letterIndex != this->transitions[index]->getSymbols().length() - 1)
+				if(letterIndex != symbols.length() - 1)
 				{
-					stringStream << this->transitions[index]->getSymbols()[letterIndex] << ",";
+					stringStream << symbols[letterIndex] << ",";
 				}
 				else
 				{
-					stringStream << this->transitions[index]->getSymbols()[letterIndex] << "},";
+					stringStream << symbols[letterIndex] << "},";
 				}
 			}
 			stringStream << ((this->transitions[index]->getDestination() != State::ERROR_STATE) ? this->transitions[index]->getDestination()->getName() : State::ERROR_STATE_NAME) << "}";
@@ -72,7 +79,17 @@ string State::getInfo()
 
 void State::setName(string name)
 {
-	this->name = name;
+	this->name = move(name);
+}
+
+void State::setId(int id)
+{
+	this->id = id;
+}
+
+void State::setTag(int tag)
+{
+	this->tag = tag;
 }
 
 void State::setInitial(bool initial)
@@ -87,42 +104,79 @@ void State::setFinal(bool final)
 
 void State::setTransitions(vector<Transition *> transitions)
 {
-	this->transitions = transitions;
+	this->transitions = move(transitions);
 }
 
 void State::setRecognitionMessage(string recognitionMessage)
 {
-	this->recognitionMessage = recognitionMessage;
+	this->recognitionMessage = move(recognitionMessage);
 }
 
-string State::getName()
+const string & State::getName() const
 {
 	return this->name;
 }
 
-bool State::isInitial()
+int State::getId() const
+{
+	return this->id;
+}
+
+int State::getTag() const
+{
+	return this->tag;
+}
+
+bool State::hasTag() const
+{
+	return this->tag != State::NO_TAG;
+}
+
+bool State::isInitial() const
 {
 	return this->initial;
 }
 
-bool State::isFinal()
+bool State::isFinal() const
 {
 	return this->final;
 }
 
-vector<Transition *> State::getTransitions()
+const vector<Transition *> & State::getTransitions() const
 {
 	return this->transitions;
 }
 
-string State::getRecognitionMessage()
+const string & State::getRecognitionMessage() const
 {
 	return this->recognitionMessage;
 }
 
-void State::addTransition(string symbols, State * destination)
+// The empty word is found on the raw symbols, as a symbol set its bytes would be ordinary symbols, and kept apart as a transition without symbols
+void State::addTransition(string_view symbols, State * destination)
 {
-	this->addTransition(new Transition(this,symbols,destination));
+	string remainingSymbols;
+	size_t emptyWord = symbols.find(DFA::EMPTY_WORD);
+	if(emptyWord == string_view::npos)
+	{
+		this->addTransition(new Transition(this,symbols,destination));
+	}
+	else
+	{
+		size_t start = 0;
+		while(emptyWord != string_view::npos)
+		{
+			remainingSymbols.append(symbols.substr(start,emptyWord - start));
+			start = emptyWord + DFA::EMPTY_WORD.length();
+			emptyWord = symbols.find(DFA::EMPTY_WORD,start);
+		}
+		remainingSymbols.append(symbols.substr(start));
+		this->addTransition(new Transition(this,"",destination));
+		if(remainingSymbols.length() > 0)
+		{
+			this->addTransition(new Transition(this,remainingSymbols,destination));
+		}
+	}
 }
 
 void State::addTransition(Transition * transition)
@@ -142,7 +196,7 @@ bool State::removeTransition(State * destination)
 	}
 }
 
-bool State::removeTransition(string destination)
+bool State::removeTransition(string_view destination)
 {
 	bool result = false;
 	for(int index = 0; index < this->transitions.size(); index++)
@@ -172,112 +226,77 @@ bool State::removeTransition(Transition * transition)
 	return result;
 }
 
-bool State::hasAllTransitions(string alphabet)
+bool State::hasAllTransitions(string_view alphabet)
 {
-	bool result = true;
-	int alphabetSize = alphabet.length();
-	if(this->transitions.size() != alphabetSize)
+	Transition alphabetTransition(this,alphabet,NULL);
+	SymbolSet usedSymbols;
+	for(int index = 0; index < this->transitions.size(); index++)
 	{
-		int counter = 0;
-		for(int index = 0; index < this->transitions.size(); index++)
-		{
-			counter += this->transitions[index]->getSymbols().size();
-		}
-		if(counter != alphabetSize)
-		{
-			result = false;
-		}
+		usedSymbols |= this->transitions[index]->getSymbolSet();
 	}
-	return result;
+	return (alphabetTransition.getSymbolSet() & ~usedSymbols).none();
 }
 
-void State::addMissingTransitions(string alphabet)
+void State::addMissingTransitions(string_view alphabet)
 {
-	int alphabetSize = alphabet.size();
-	string usedSymbols, missingSymbols;
-	missingSymbols = alphabet;
+	Transition * missingTransition = new Transition(this,alphabet,(State *)State::ERROR_STATE);
+	SymbolSet usedSymbols;
 	for(int index = 0; index < this->transitions.size(); index++)
 	{
-		Transition * currentTransition = this->transitions[index];
-		usedSymbols += currentTransition->getSymbols();
+		usedSymbols |= this->transitions[index]->getSymbolSet();
 	}
-	for(int index = 0; index < usedSymbols.length(); index++)
-	{
-		missingSymbols.erase(remove(missingSymbols.begin(),missingSymbols.end(),usedSymbols[index]),missingSymbols.end());
-	}
-	this->addTransition(missingSymbols,(State *)State::ERROR_STATE);
+	missingTransition->setSymbolSet(missingTransition->getSymbolSet() & ~usedSymbols);
+	this->addTransition(missingTransition);
 }
 
 void State::removeDuplicatedTransitions()
 {
-	int dynamicSize = this->transitions.size();
-	for(int index = 0; index < dynamicSize; index++)
+	map<pair<State *,bool>,Transition *> transitionsByDestination;
+	vector<Transition *> mergedTransitions;
+	for(int index = 0; index < this->transitions.size(); index++)
 	{
+		// Empty word transitions are only merged among themselves, so they are never hidden by symbols
 		Transition * currentTransition = this->transitions[index];
-		for(int repeater = 0; repeater < dynamicSize; repeater++)
+		pair<State *,bool> key(currentTransition->getDestination(),currentTransition->hasEmptyWord());
+		map<pair<State *,bool>,Transition *>::iterator found = transitionsByDestination.find(key);
+		if(found == transitionsByDestination.end())
 		{
-			if(repeater != index)
-			{
-				if(currentTransition->getDestination() == this->transitions[repeater]->getDestination())
-				{
-					currentTransition->setSymbols(currentTransition->getSymbols() + this->transitions[repeater]->getSymbols());
-					currentTransition->trimSymbols();
-					if(this->removeTransition(this->transitions[index]))
-					{
-						dynamicSize--;
-					}
-				}
-			}
+			transitionsByDestination[key] = currentTransition;
+			mergedTransitions.push_back(currentTransition);
+		}
+		else
+		{
+			found->second->addSymbols(currentTransition->getSymbolSet());
+			delete currentTransition;
 		}
 	}
+	this->transitions = mergedTransitions;
 }
 
 bool State::hasNondeterministicTransitions()
 {
-	bool result = false;
+	map<State *,SymbolSet> symbolsByDestination;
+	SymbolSet usedSymbols;
 	for(int index = 0; index < this->transitions.size(); index++)
 	{
-		if(!result)
-		{
-			Transition * currentTransition = this->transitions[index];
-			for(int repeater = 0; repeater < this->transitions.size(); repeater++)
-			{
-				if(result)
-				{
-					if(repeater != index)
-					{
-						if((currentTransition->getDestination() != this->transitions[repeater]->getDestination())
-							&& (currentTransition->getSource() == this->transitions[repeater]->getSource()))
-						{
-							for(int symbol = 0; symbol < currentTransition->getSymbols().length(); symbol++)
-							{
-								char currentSymbol = currentTransition->getSymbols()[symbol];
-								if(this->transitions[repeater]->getSymbols().find(currentSymbol) != string::npos)
-								{
-									result = true;
-									break;
-								}
-							}
-						}
-					}
-				}
-				else
-				{
-					break;
-				}
-			}
-		}
-		else
+		symbolsByDestination[this->transitions[index]->getDestination()] |= this->transitions[index]->getSymbolSet();
+	}
+	for(map<State *,SymbolSet>::iterator iterator = symbolsByDestination.begin(); iterator != symbolsByDestination.end(); iterator++)
+	{
+		if((usedSymbols & iterator->second).any())
 		{
-			break;
+			return true;
 		}
+		usedSymbols |= iterator->second;
 	}
-	return result;
+	return false;
 }
 
 void State::clear()
 {
 	this->name.clear();
+	this->id = State::NO_ID;
+	this->tag = State::NO_TAG;
 	this->initial = false;
 	this->final = false;
 	for(int index = 0; index < this->transitions.size(); index++)
@@ -6,6 +6,7 @@
 #define __state__
 
 #include <vector>
+#include <map>
 #include "Transition.h"
 
 using namespace std;
@@ -15,6 +16,8 @@ class State
 	private:
 		static const int EQUAL_STRINGS;
 		string name;
+		int id;
+		int tag;
 		bool initial;
 		bool final;
 		vector<Transition *> transitions;
@@ -24,25 +27,32 @@ class State
 	public:
 		static const State * ERROR_STATE;
 		static const string ERROR_STATE_NAME;
+		static const int NO_ID;
+		static const int NO_TAG;
 		State(string name = "Nameless state", bool initial = false, bool final = false, vector<Transition *> transitions = vector<Transition *>(), string recognitionMessage = "Not recognizable");
 		~State();
 		void setName(string name);
+		void setId(int id);
+		void setTag(int tag);
 		void setInitial(bool initial);
 		void setFinal(bool final);
 		void setTransitions(vector<Transition *> transitions);
 		void setRecognitionMessage(string recognitionMessage);
-		string getName();
-		bool isInitial();
-		bool isFinal();
-		vector<Transition *> getTransitions();
-		string getRecognitionMessage();
-		void addTransition(string symbols, State * destination);
+		const string & getName() const;
+		int getId() const;
+		int getTag() const;
+		bool hasTag() const;
+		bool isInitial() const;
+		bool isFinal() const;
+		const vector<Transition *> & getTransitions() const;
+		const string & getRecognitionMessage() const;
+		void addTransition(string_view symbols, State * destination);
 		void addTransition(Transition * transition);
 		bool removeTransition(State * destination);
-		bool removeTransition(string destination);
+		bool removeTransition(string_view destination);
 		bool removeTransition(Transition * transition);
-		bool hasAllTransitions(string alphabet);
-		void addMissingTransitions(string alphabet);
+		bool hasAllTransitions(string_view alphabet);
+		void addMissingTransitions(string_view alphabet);
 		void removeDuplicatedTransitions();
 		bool hasNondeterministicTransitions();
 		void clear();
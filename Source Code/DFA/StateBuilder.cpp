@@ -16,7 +16,7 @@ StateBuilder::~StateBuilder()
 
 StateBuilder * StateBuilder::buildName(string name)
 {
-	this->state->setName(name);
+	this->state->setName(move(name));
 	return this;
 }
 
@@ -34,11 +34,11 @@ StateBuilder * StateBuilder::buildFinal(bool final)
 
 StateBuilder * StateBuilder::buildTransitions(vector<Transition *> transitions)
 {
-	this->state->setTransitions(transitions);
+	this->state->setTransitions(move(transitions));
 	return this;
 }
 
-StateBuilder * StateBuilder::buildTransition(string symbols, State * destination)
+StateBuilder * StateBuilder::buildTransition(string_view symbols, State * destination)
 {
 	this->state->addTransition(symbols,destination);
 	return this;
@@ -46,7 +46,7 @@ StateBuilder * StateBuilder::buildTransition(string symbols, State * destination
 
 StateBuilder * StateBuilder::buildRecognitionMessage(string recognitionMessage)
 {
-	this->state->setRecognitionMessage(recognitionMessage);
+	this->state->setRecognitionMessage(move(recognitionMessage));
 	return this;
 }
 
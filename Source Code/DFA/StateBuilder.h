@@ -21,7 +21,7 @@ class StateBuilder
 		StateBuilder * buildInitial(bool initial);
 		StateBuilder * buildFinal(bool final);
 		StateBuilder * buildTransitions(vector<Transition *> transitions);
-		StateBuilder * buildTransition(string symbols, State * destination);
+		StateBuilder * buildTransition(string_view symbols, State * destination);
 		StateBuilder * buildRecognitionMessage(string recognitionMessage);
 		State * build();
 		State * getBuildingInstance();
@@ -0,0 +1,92 @@
+// StaticDFA.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __static_dfa__
+#define __static_dfa__
+
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+typedef struct StaticDFAValidationResult
+{
+	bool valid;
+	int state;
+	int recognizer;
+	int tag;
+}
+StaticDFAValidationResult;
+
+// Runs a table generated by DFAJSONToStatic, which provides STATES_COUNT, CLASSES_COUNT, INITIAL_STATE,
+// SYMBOL_CLASSES, TRANSITION_TABLE, RECOGNIZERS and FINAL_STATE_TAGS as constexpr members
+template <typename Table>
+class StaticDFA
+{
+	public:
+		static constexpr int ERROR_STATE_INDEX = -1;
+		static constexpr int NO_RECOGNIZER = -1;
+
+		static constexpr int run(const char * input, size_t length)
+		{
+			int currentState = Table::INITIAL_STATE;
+			for(size_t index = 0; index < length && currentState != StaticDFA::ERROR_STATE_INDEX; index++)
+			{
+				currentState = Table::TRANSITION_TABLE[currentState * Table::CLASSES_COUNT + Table::SYMBOL_CLASSES[(unsigned char)input[index]]];
+			}
+			return currentState;
+		}
+
+		static constexpr bool accepts(const char * input, size_t length)
+		{
+			int currentState = StaticDFA::run(input,length);
+			return currentState != StaticDFA::ERROR_STATE_INDEX && Table::RECOGNIZERS[currentState] != StaticDFA::NO_RECOGNIZER;
+		}
+
+		// Runs the longest accepted prefix of [begin,end), its length is stored at length and its state returned
+		static constexpr int longestMatch(const char * begin, const char * end, size_t & length)
+		{
+			int currentState = Table::INITIAL_STATE, acceptingState = StaticDFA::ERROR_STATE_INDEX;
+			length = 0;
+			for(const char * cursor = begin; currentState != StaticDFA::ERROR_STATE_INDEX; cursor++)
+			{
+				if(Table::RECOGNIZERS[currentState] != StaticDFA::NO_RECOGNIZER)
+				{
+					acceptingState = currentState;
+					length = cursor - begin;
+				}
+				if(cursor == end)
+				{
+					break;
+				}
+				currentState = Table::TRANSITION_TABLE[currentState * Table::CLASSES_COUNT + Table::SYMBOL_CLASSES[(unsigned char)*cursor]];
+			}
+			return acceptingState;
+		}
+
+		static constexpr StaticDFAValidationResult getResult(int state)
+		{
+			StaticDFAValidationResult result = {false,state,StaticDFA::NO_RECOGNIZER,StaticDFA::NO_RECOGNIZER};
+			result.valid = state != StaticDFA::ERROR_STATE_INDEX && Table::RECOGNIZERS[state] != StaticDFA::NO_RECOGNIZER;
+			result.recognizer = ((result.valid) ? Table::RECOGNIZERS[state] : StaticDFA::NO_RECOGNIZER);
+			result.tag = ((result.valid) ? Table::FINAL_STATE_TAGS[state] : StaticDFA::NO_RECOGNIZER);
+			return result;
+		}
+
+		static StaticDFAValidationResult validate(string_view input)
+		{
+			return StaticDFA::getResult(StaticDFA::run(input.data(),input.length()));
+		}
+
+		// Validates several inputs per call, without the per-call overhead of validate
+		static void validateBatch(const string_view * inputs, StaticDFAValidationResult * results, size_t count)
+		{
+			for(size_t index = 0; index < count; index++)
+			{
+				results[index] = StaticDFA::getResult(StaticDFA::run(inputs[index].data(),inputs[index].length()));
+			}
+		}
+};
+
+#endif
@@ -6,7 +6,14 @@
 #include "State.h"
 #include "DFA.h"
 
-Transition::Transition(State * source, string symbols, State * destination)
+Transition::Transition(State * source, string_view symbols, State * destination)
+{
+	this->source = source;
+	this->setSymbols(symbols);
+	this->destination = destination;
+}
+
+Transition::Transition(State * source, const SymbolSet & symbols, State * destination)
 {
 	this->source = source;
 	this->symbols = symbols;
@@ -23,16 +30,17 @@ string Transition::getInfo()
 	ostringstream stringStream;
 	stringStream << "Transition" << endl;
 	stringStream << "\t source: " << ((this->source != State::ERROR_STATE) ? this->source->getName() : State::ERROR_STATE_NAME) << endl;
-	stringStream << "\t symbols: " << ((this->symbols.length() > 0) ? "{" : "{" + DFA::EMPTY_WORD + "}");
-	for(int index = 0; index < this->symbols.length(); index++)
+	string symbols = this->getSymbols();
+	stringStream << "\t symbols: " << ((symbols.length() > 0) ? "{" : "{" + DFA::EMPTY_WORD + "}");
+	for(int index = 0; index < symbols.length(); index++)
 	{
-		if(index != this->symbols.length() - 1)
+		if(index != symbols.length() - 1)
 		{
-			stringStream << this->symbols[index] << ", ";
+			stringStream << symbols[index] << ", ";
 		}
 		else
 		{
-			stringStream << this->symbols[index] << "}";
+			stringStream << symbols[index] << "}";
 		}
 	}
 	stringStream << endl;
@@ -45,7 +53,16 @@ void Transition::setSource(State * source)
 	this->source = source;
 }
 
-void Transition::setSymbols(string symbols)
+void Transition::setSymbols(string_view symbols)
+{
+	this->symbols.reset();
+	for(int index = 0; index < symbols.length(); index++)
+	{
+		this->symbols.set((unsigned char)symbols[index]);
+	}
+}
+
+void Transition::setSymbolSet(const SymbolSet & symbols)
 {
 	this->symbols = symbols;
 }
@@ -55,46 +72,73 @@ void Transition::setDestination(State * destination)
 	this->destination = destination;
 }
 
-State * Transition::getSource()
+State * Transition::getSource() const
 {
 	return this->source;
 }
 
-string Transition::getSymbols()
+string Transition::getSymbols() const
+{
+	string symbols;
+	for(int symbol = 0; symbol < this->symbols.size(); symbol++)
+	{
+		if(this->symbols.test(symbol))
+		{
+			symbols.push_back((char)symbol);
+		}
+	}
+	return symbols;
+}
+
+const SymbolSet & Transition::getSymbolSet() const
 {
 	return this->symbols;
 }
 
-State * Transition::getDestination()
+int Transition::getSymbolsCount() const
+{
+	return this->symbols.count();
+}
+
+State * Transition::getDestination() const
 {
 	return this->destination;
 }
 
-bool Transition::hasSymbol(char symbol)
+bool Transition::hasSymbol(char symbol) const
+{
+	return this->symbols.test((unsigned char)symbol);
+}
+
+bool Transition::hasSymbol(string_view symbol) const
 {
-	return (this->symbols.find(symbol) != string::npos);
+	bool result = symbol.length() > 0;
+	for(int index = 0; index < symbol.length() && result; index++)
+	{
+		result = this->symbols.test((unsigned char)symbol[index]);
+	}
+	return result;
 }
 
-bool Transition::hasSymbol(string symbol)
+void Transition::addSymbols(const SymbolSet & symbols)
 {
-	return (this->symbols.find(symbol) != string::npos);
+	this->symbols |= symbols;
 }
 
-void Transition::trimSymbols()
+bool Transition::sharesSymbolsWith(Transition * transition) const
 {
-	sort(this->symbols.begin(),this->symbols.end());
-	this->symbols.erase(unique(this->symbols.begin(),this->symbols.end()),this->symbols.end());
+	return (this->symbols & transition->symbols).any();
 }
 
-bool Transition::hasEmptyWord()
+bool Transition::hasEmptyWord() const
 {
-	return (this->hasSymbol(DFA::EMPTY_WORD)) || (this->symbols.length() == 0);
+	return this->symbols.none();
 }
 
 void Transition::clear()
 {
 	this->source = (State *)State::ERROR_STATE;
-	this->symbols.clear();
+	this->symbols.reset();
 	this->destination = (State *)State::ERROR_STATE;
 }
 
@@ -9,33 +9,42 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <bitset>
 
 using namespace std;
 
+typedef bitset<256> SymbolSet;
+
 class State;
 
 class Transition
 {
 	private:
 		State * source;
-		string symbols;
+		SymbolSet symbols;
 		State * destination;
 		string getInfo();
 
 	public:
-		Transition(State * source = NULL, string symbols = "", State * destination = NULL);
+		Transition(State * source = NULL, string_view symbols = "", State * destination = NULL);
+		Transition(State * source, const SymbolSet & symbols, State * destination);
 		~Transition();
 		void setSource(State * source);
-		void setSymbols(string symbols);
+		void setSymbols(string_view symbols);
+		void setSymbolSet(const SymbolSet & symbols);
 		void setDestination(State * destination);
-		State * getSource();
-		string getSymbols();
-		State * getDestination();
-		bool hasSymbol(char symbol);
-		bool hasSymbol(string symbol);
-		void trimSymbols();
-		bool hasEmptyWord();
+		State * getSource() const;
+		string getSymbols() const;
+		const SymbolSet & getSymbolSet() const;
+		int getSymbolsCount() const;
+		State * getDestination() const;
+		bool hasSymbol(char symbol) const;
+		bool hasSymbol(string_view symbol) const;
+		void addSymbols(const SymbolSet & symbols);
+		bool sharesSymbolsWith(Transition * transition) const;
+		bool hasEmptyWord() const;
 		void clear();
 		void printInfo(ofstream * fileToPrint = NULL);
 		friend ostream & operator <<(ostream & output, Transition & transition);
@@ -0,0 +1,284 @@
+// XMLReader.cpp
+// Kaê Angeli Coutinho
+// MIT license
+
+#include "XMLReader.h"
+
+const int XMLReader::START_ELEMENT = 0;
+const int XMLReader::END_ELEMENT = 1;
+const int XMLReader::TEXT = 2;
+const int XMLReader::END_OF_DOCUMENT = 3;
+const string XMLReader::MALFORMED_XML_EXCEPTION = "Malformed XML";
+
+XMLReader::XMLReader(istream & input) : input(input)
+{
+	this->pendingEndElement = false;
+}
+
+int XMLReader::readCharacter()
+{
+	int character = this->input.get();
+	if(character == EOF)
+	{
+		throw XMLReader::MALFORMED_XML_EXCEPTION + ": unexpected end of document";
+	}
+	return character;
+}
+
+int XMLReader::peekCharacter()
+{
+	return this->input.peek();
+}
+
+void XMLReader::skipUntil(string delimiter)
+{
+	string window;
+	while(window.length() < delimiter.length() || window.compare(window.length() - delimiter.length(),delimiter.length(),delimiter) != 0)
+	{
+		window.push_back((char)this->readCharacter());
+		if(window.length() > delimiter.length())
+		{
+			window.erase(0,1);
+		}
+	}
+}
+
+void XMLReader::skipSpaces()
+{
+	while(isspace(this->peekCharacter()))
+	{
+		this->input.get();
+	}
+}
+
+string XMLReader::readName()
+{
+	string name;
+	while(this->peekCharacter() != EOF && !isspace(this->peekCharacter()) && this->peekCharacter() != '>' && this->peekCharacter() != '/' && this->peekCharacter() != '=')
+	{
+		name.push_back((char)this->input.get());
+	}
+	if(name.empty())
+	{
+		throw XMLReader::MALFORMED_XML_EXCEPTION + ": missing name";
+	}
+	return name;
+}
+
+string XMLReader::decodeEntities(string value)
+{
+	string decoded;
+	for(size_t index = 0; index < value.length(); index++)
+	{
+		size_t end;
+		string entity;
+		if(value[index] != '&')
+		{
+			decoded.push_back(value[index]);
+			continue;
+		}
+		end = value.find(';',index);
+		if(end == string::npos)
+		{
+			throw XMLReader::MALFORMED_XML_EXCEPTION + ": unterminated entity";
+		}
+		entity = value.substr(index + 1,end - index - 1);
+		if(entity == "lt")
+		{
+			decoded.push_back('<');
+		}
+		else if(entity == "gt")
+		{
+			decoded.push_back('>');
+		}
+		else if(entity == "amp")
+		{
+			decoded.push_back('&');
+		}
+		else if(entity == "quot")
+		{
+			decoded.push_back('"');
+		}
+		else if(entity == "apos")
+		{
+			decoded.push_back('\'');
+		}
+		else if(entity.length() > 1 && entity[0] == '#')
+		{
+			unsigned long codePoint = (entity[1] == 'x') ? strtoul(entity.c_str() + 2,NULL,16) : strtoul(entity.c_str() + 1,NULL,10);
+
+			// Code points are written back in UTF-8, as the rest of the document
+			if(codePoint < 0x80)
+			{
+				decoded.push_back((char)codePoint);
+			}
+			else if(codePoint < 0x800)
+			{
+				decoded.push_back((char)(0xC0 | (codePoint >> 6)));
+				decoded.push_back((char)(0x80 | (codePoint & 0x3F)));
+			}
+			else if(codePoint < 0x10000)
+			{
+				decoded.push_back((char)(0xE0 | (codePoint >> 12)));
+				decoded.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+				decoded.push_back((char)(0x80 | (codePoint & 0x3F)));
+			}
+			else
+			{
+				decoded.push_back((char)(0xF0 | (codePoint >> 18)));
+				decoded.push_back((char)(0x80 | ((codePoint >> 12) & 0x3F)));
+				decoded.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+				decoded.push_back((char)(0x80 | (codePoint & 0x3F)));
+			}
+		}
+		else
+		{
+			throw XMLReader::MALFORMED_XML_EXCEPTION + ": unknown entity &" + entity + ";";
+		}
+		index = end;
+	}
+	return decoded;
+}
+
+void XMLReader::readStartElement()
+{
+	this->name = this->readName();
+	this->attributes.clear();
+	while(true)
+	{
+		int character;
+		this->skipSpaces();
+		character = this->readCharacter();
+		if(character == '>')
+		{
+			break;
+		}
+		if(character == '/')
+		{
+			if(this->readCharacter() != '>')
+			{
+				throw XMLReader::MALFORMED_XML_EXCEPTION + ": expected > after / in " + this->name;
+			}
+			this->pendingEndElement = true;
+			break;
+		}
+		this->input.unget();
+		{
+			string attributeName = this->readName(), value;
+			int quote;
+			this->skipSpaces();
+			if(this->readCharacter() != '=')
+			{
+				throw XMLReader::MALFORMED_XML_EXCEPTION + ": expected = after " + attributeName;
+			}
+			this->skipSpaces();
+			quote = this->readCharacter();
+			if(quote != '"' && quote != '\'')
+			{
+				throw XMLReader::MALFORMED_XML_EXCEPTION + ": unquoted value of " + attributeName;
+			}
+			for(character = this->readCharacter(); character != quote; character = this->readCharacter())
+			{
+				value.push_back((char)character);
+			}
+			this->attributes[attributeName] = this->decodeEntities(value);
+		}
+	}
+}
+
+void XMLReader::readEndElement()
+{
+	this->name = this->readName();
+	this->attributes.clear();
+	this->skipSpaces();
+	if(this->readCharacter() != '>')
+	{
+		throw XMLReader::MALFORMED_XML_EXCEPTION + ": expected > after /" + this->name;
+	}
+}
+
+int XMLReader::next()
+{
+	if(this->pendingEndElement)
+	{
+		this->pendingEndElement = false;
+		return XMLReader::END_ELEMENT;
+	}
+	while(true)
+	{
+		int character = this->input.get();
+		if(character == EOF)
+		{
+			return XMLReader::END_OF_DOCUMENT;
+		}
+		if(character != '<')
+		{
+			string value(1,(char)character);
+			while(this->peekCharacter() != EOF && this->peekCharacter() != '<')
+			{
+				value.push_back((char)this->input.get());
+			}
+			this->text = this->decodeEntities(value);
+			return XMLReader::TEXT;
+		}
+		character = this->readCharacter();
+		if(character == '?')
+		{
+			this->skipUntil("?>");
+		}
+		else if(character == '!')
+		{
+			if(this->peekCharacter() == '-')
+			{
+				this->skipUntil("-->");
+			}
+			else if(this->peekCharacter() == '[')
+			{
+				this->skipUntil("CDATA[");
+				this->text.clear();
+				while(this->text.length() < 3 || this->text.compare(this->text.length() - 3,3,"]]>") != 0)
+				{
+					this->text.push_back((char)this->readCharacter());
+				}
+				this->text.resize(this->text.length() - 3);
+				return XMLReader::TEXT;
+			}
+			else
+			{
+				this->skipUntil(">");
+			}
+		}
+		else if(character == '/')
+		{
+			this->readEndElement();
+			return XMLReader::END_ELEMENT;
+		}
+		else
+		{
+			this->input.unget();
+			this->readStartElement();
+			return XMLReader::START_ELEMENT;
+		}
+	}
+}
+
+const string & XMLReader::getName() const
+{
+	return this->name;
+}
+
+const string & XMLReader::getText() const
+{
+	return this->text;
+}
+
+bool XMLReader::hasAttribute(const string & name) const
+{
+	return this->attributes.find(name) != this->attributes.end();
+}
+
+string XMLReader::getAttribute(const string & name) const
+{
+	map<string,string>::const_iterator attribute = this->attributes.find(name);
+	return ((attribute != this->attributes.end()) ? attribute->second : "");
+}
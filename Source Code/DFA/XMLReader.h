@@ -0,0 +1,47 @@
+// XMLReader.h
+// Kaê Angeli Coutinho
+// MIT license
+
+#ifndef __xml_reader__
+#define __xml_reader__
+
+#include <iostream>
+#include <string>
+#include <map>
+
+using namespace std;
+
+// Streaming reader of the XML subset written by JFLAP, every call to next reads one event from the input
+// Declarations, comments and doctypes are skipped, character and predefined entities are decoded
+class XMLReader
+{
+	private:
+		istream & input;
+		string name;
+		map<string,string> attributes;
+		string text;
+		bool pendingEndElement;
+		int readCharacter();
+		int peekCharacter();
+		void skipUntil(string delimiter);
+		void skipSpaces();
+		string readName();
+		string decodeEntities(string value);
+		void readStartElement();
+		void readEndElement();
+
+	public:
+		static const int START_ELEMENT;
+		static const int END_ELEMENT;
+		static const int TEXT;
+		static const int END_OF_DOCUMENT;
+		static const string MALFORMED_XML_EXCEPTION;
+		XMLReader(istream & input);
+		int next();
+		const string & getName() const;
+		const string & getText() const;
+		bool hasAttribute(const string & name) const;
+		string getAttribute(const string & name) const;
+};
+
+#endif
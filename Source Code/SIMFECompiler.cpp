@@ -11,6 +11,27 @@
 
 int main(int argumentsCount, char ** arguments)
 {
-	// Compiles the given SIM source code
-	return compileSIMSourceCode(argumentsCount,arguments);
+	int result = EXIT_FAILURE;
+	try
+	{
+		// Loads the resources shared by the compilations
+		initializeCompilerResources();
+
+		// Compiles the given SIM source code
+		result = compileSIMSourceCode(argumentsCount,arguments);
+	}
+	catch(const char * exception)
+	{
+		cout << exception;
+		showOutput(true,EMPTY_STRING);
+	}
+	catch(const string exception)
+	{
+		cout << exception;
+		showOutput(true,EMPTY_STRING);
+	}
+
+	// Releases the resources shared by the compilations
+	destroyCompilerResources();
+	return result;
 }
@@ -58,15 +58,6 @@
 #define SEPARATOR ";"
 #define CUSTOM_OUTPUT_END "\e[0m"
 
-// Recognizers constants
-
-#define IDENTIFIERS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFEIdentifiersRecognizer.json"
-#define KEYWORDS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFEKeywordsRecognizer.json"
-#define LITERALS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFELiteralsRecognizer.json"
-#define NUMBERS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFENumbersRecognizer.json"
-#define PUNCTUATIONS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFEPunctuationsRecognizer.json"
-#define RELATIONAL_LOGICAL_OPERATORS_RECOGNIZER_PARTIAL_PATH "/Recognizers/SIMFERelationalLogicalOperatorsRecognizer.json"
-
 // Grammar constants
 
 #define LL1_GRAMMAR_PARTIAL_PATH "/Grammar/SIMLL1Grammar.json"
@@ -176,6 +167,17 @@ typedef enum tokenType
 	TT_PUNCTUATION
 }tokenType;
 
+// Enumerated type that represents all of the recognizers, ordered by their waterfall priority
+typedef enum recognizerType
+{
+	RT_KEYWORDS,
+	RT_RELATIONAL_LOGICAL_OPERATORS,
+	RT_PUNCTUATIONS,
+	RT_NUMBERS,
+	RT_LITERALS,
+	RT_IDENTIFIERS
+}recognizerType;
+
 // Enumerated type that represents all of the keywords recognizer's final states
 typedef enum keywordsRecognizerFinalStates
 {
@@ -238,7 +240,6 @@ typedef enum errorType
 	UNKNOWN_ERROR,
 	TOO_MUCH_ARGUMENTS_ERROR,
 	MAKEFILE_NOT_USED_ERROR,
-	RECOGNIZERS_MODEL_FILES_OPENING_ERROR,
 	LEXICAL_ERROR,
 	SYNTATICAL_ERROR,
 	GRAMMAR_FILE_OPENING_ERROR,
@@ -295,6 +296,14 @@ struct pseudoToken
 // Represents an inner map inside a map structure
 typedef map<string,string> innerMap;
 
+// Represents the resources shared by all compilations, loaded once and read-only afterwards
+typedef struct compilerResources compilerResources;
+struct compilerResources
+{
+	bool initialized;
+	map<string,innerMap> ll1GrammarMap;
+};
+
 // Represents a symbol containing its category, type, number, name, value and scope
 typedef struct symbol symbol;
 struct symbol
@@ -22,6 +22,8 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
 #include "DFA/DFA.h"
+#include "DFA/StaticDFA.h"
+#include "Recognizers/SIMFERecognizers.h"
 
 // Used namespaces
 
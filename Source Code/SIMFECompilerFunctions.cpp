@@ -7,6 +7,11 @@
 
 #include "SIMFECompilerFunctions.h"
 
+// Global variables
+
+// Resources shared by all compilations (the lexical recognizers are constexpr tables, see SIMFERecognizers.h)
+compilerResources sharedCompilerResources = {false};
+
 // Function bodies
 
 // Compiler functions
@@ -89,9 +94,6 @@ void handleError(errorType type, string extraMessage)
 		case MAKEFILE_NOT_USED_ERROR:
 			message << "SIMFECompiler must be generated through Makefile" << CUSTOM_OUTPUT_END;
 			break;
-		case RECOGNIZERS_MODEL_FILES_OPENING_ERROR:
-			message << "Could not open the recognizers model files" << CUSTOM_OUTPUT_END;
-			break;
 		case LEXICAL_ERROR:
 			message << "Lexical error" << CUSTOM_OUTPUT_END << CUSTOM_OUTPUT_START << BOLD << SEPARATOR << RED_TEXT_DEBUG_COLOR << CUSTOM_OUTPUT_CONTINUE << " - " << extraMessage << CUSTOM_OUTPUT_END;
 			break;
@@ -156,72 +158,27 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 	lexeme unidentifiedLexeme;
 	map<string,int> identifiersNumbers;
 	int currentIdentifiersNumber = 0;
-	DFA * identifiersRecognizer = NULL, * keywordsRecognizer = NULL, * literalsRecognizer = NULL, * numbersRecognizer = NULL, * punctuationsRecognizer = NULL, * relationalLogicalOperatosRecognizer = NULL;
-	ifstream identifiersRecognizerModel, keywordsRecognizerModel, literalsRecognizerModel, numbersRecognizerModel, punctuationsRecognizerModel, relationalLogicalOperatosRecognizerModel;
-	DFAValidationResult resultKeywordsRecognizer, resultRelationalLogicalOperatorsRecognizer, resultPunctuationsRecognizer, resultNumbersRecognizer, resultLiteralsRecognizer, resultIdentifiersRecognizer;
-	
-	// Checks if project was compiled through Makefile
-	if(MAKEFILE_REQUIRED_USAGE_CRITICAL_ERROR)
+	vector<string_view> lexemesContents;
+	vector<StaticDFAValidationResult> results(lexemes.size());
+
+	// Validates all lexemes at once, each result carries the recognizer with the highest priority and its final state tag
+	for(int lexemeIndex = 0; lexemeIndex < lexemes.size(); lexemeIndex++)
 	{
-		handleError(MAKEFILE_NOT_USED_ERROR);
+		lexemesContents.push_back(lexemes[lexemeIndex].contents);
 	}
-
-	// Open the recognizers JSON models
-	identifiersRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(IDENTIFIERS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-	keywordsRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(KEYWORDS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-	literalsRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(LITERALS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-	numbersRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(NUMBERS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-	punctuationsRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(PUNCTUATIONS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-	relationalLogicalOperatosRecognizerModel.open(string(PROJECT_DIRECTORY_PATH).append(string(RELATIONAL_LOGICAL_OPERATORS_RECOGNIZER_PARTIAL_PATH)),ios::in);
-
-	// Checks if files were properly opened
-	if(identifiersRecognizerModel.bad() || keywordsRecognizerModel.bad() || literalsRecognizerModel.bad() || numbersRecognizerModel.bad() || punctuationsRecognizerModel.bad() || relationalLogicalOperatosRecognizerModel.bad())
-	{
-		handleError(RECOGNIZERS_MODEL_FILES_OPENING_ERROR);
-	}
-
-	// Instantiate the recognizers
-	identifiersRecognizer = new DFA(identifiersRecognizerModel);
-	keywordsRecognizer = new DFA(keywordsRecognizerModel);
-	literalsRecognizer = new DFA(literalsRecognizerModel);
-	numbersRecognizer = new DFA(numbersRecognizerModel);
-	punctuationsRecognizer = new DFA(punctuationsRecognizerModel);
-	relationalLogicalOperatosRecognizer = new DFA(relationalLogicalOperatosRecognizerModel);
-
-	// Close the recognizers JSON models
-	identifiersRecognizerModel.close();
-	keywordsRecognizerModel.close();
-	literalsRecognizerModel.close();
-	numbersRecognizerModel.close();
-	punctuationsRecognizerModel.close();
-	relationalLogicalOperatosRecognizerModel.close();
-
-	// Validate and fix wrong transitions of the recognizers
-	identifiersRecognizer->preValidate();
-	keywordsRecognizer->preValidate();
-	literalsRecognizer->preValidate();
-	numbersRecognizer->preValidate();
-	punctuationsRecognizer->preValidate();
-	relationalLogicalOperatosRecognizer->preValidate();
+	StaticDFA<SIMFELexicalRecognizer>::validateBatch(lexemesContents.data(),results.data(),lexemesContents.size());
 
 	// Tokens validation, waterfall aproach
 	for(int lexemeIndex = 0; lexemeIndex < lexemes.size(); lexemeIndex++)
 	{
 		string currentLexeme = lexemes[lexemeIndex].contents;
 		int currentLineNumber = lexemes[lexemeIndex].lineNumber;
-
-		// Validations result
-		resultKeywordsRecognizer = keywordsRecognizer->validate(currentLexeme);
-		resultRelationalLogicalOperatorsRecognizer = relationalLogicalOperatosRecognizer->validate(currentLexeme);
-		resultPunctuationsRecognizer = punctuationsRecognizer->validate(currentLexeme);
-		resultNumbersRecognizer = numbersRecognizer->validate(currentLexeme);
-		resultLiteralsRecognizer = literalsRecognizer->validate(currentLexeme);
-		resultIdentifiersRecognizer = identifiersRecognizer->validate(currentLexeme);
+		const StaticDFAValidationResult & result = results[lexemeIndex];
 
 		// Keyword found
-		if(resultKeywordsRecognizer.valid)
+		if(result.recognizer == RT_KEYWORDS)
 		{
-			int currentStateNumber = atoi(resultKeywordsRecognizer.currentState->getName().substr(1).c_str());
+			int currentStateNumber = result.tag;
 			tokenType type;
 
 			// Finds out keyword type
@@ -299,9 +256,9 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 		}
 
 		// Relational logical operator found
-		else if(resultRelationalLogicalOperatorsRecognizer.valid)
+		else if(result.recognizer == RT_RELATIONAL_LOGICAL_OPERATORS)
 		{
-			int currentStateNumber = atoi(resultRelationalLogicalOperatorsRecognizer.currentState->getName().substr(1).c_str());
+			int currentStateNumber = result.tag;
 			tokenType type;
 			
 			// Finds out relational logical operator type
@@ -331,9 +288,9 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 		}
 
 		// Punctuation found
-		else if(resultPunctuationsRecognizer.valid)
+		else if(result.recognizer == RT_PUNCTUATIONS)
 		{
-			int currentStateNumber = atoi(resultPunctuationsRecognizer.currentState->getName().substr(1).c_str());
+			int currentStateNumber = result.tag;
 			tokenType type;
 			
 			// Finds out punctuation type
@@ -363,13 +320,13 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 		}
 
 		// Number found
-		else if(resultNumbersRecognizer.valid)
+		else if(result.recognizer == RT_NUMBERS)
 		{
 			tokens.push_back(createToken(TT_NUMBER,currentLineNumber,currentLexeme));
 		}
 
 		// Literal found
-		else if(resultLiteralsRecognizer.valid)
+		else if(result.recognizer == RT_LITERALS)
 		{
 			// Splits the into punctuations and literal
 			erase_all(currentLexeme,SA_QUOTE);
@@ -379,7 +336,7 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 		}
 
 		// Identifier found
-		else if(resultIdentifiersRecognizer.valid)
+		else if(result.recognizer == RT_IDENTIFIERS)
 		{
 			if(identifiersNumbers.find(currentLexeme) == identifiersNumbers.end())
 			{
@@ -405,19 +362,6 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 		handleError(LEXICAL_ERROR,(fileName + ":" + to_string(unidentifiedLexeme.lineNumber) + ": unidentified lexeme called '" + unidentifiedLexeme.contents + "'"));
 	}
 
-	// Checks if recognizers were properly allocated before deletion
-	if(identifiersRecognizer != NULL && keywordsRecognizer != NULL && literalsRecognizer != NULL &&
-		numbersRecognizer != NULL && punctuationsRecognizer != NULL && relationalLogicalOperatosRecognizer != NULL)
-	{
-			// Delete the recognizers
-			delete identifiersRecognizer;
-			delete keywordsRecognizer;
-			delete literalsRecognizer;
-			delete numbersRecognizer;
-			delete punctuationsRecognizer;
-			delete relationalLogicalOperatosRecognizer;
-	}
-
 	// Returns whether the analysis was successful or not
 	return validAnalysis;
 }
@@ -425,37 +369,14 @@ bool lexicalAnalyzeSIMSourceCode(vector<lexeme> & lexemes, vector<token> & token
 // Does the syntax analysis (using LL(1) top-down approach) on a SIM source code
 bool syntaticalAnalyzeSIMSourceCode(vector<token> & tokens, string fileName)
 {
-	bool validAnalysis = true, stopAnalysis = false, overrideFlag = false;
-	ifstream ll1GrammarFile;
-	map<string,innerMap> ll1GrammarMap;
+	bool validAnalysis = true, stopAnalysis = false;
 	queue<pseudoToken> inputQueue;
 	stack<string> symbolsStack;
 	string currentSymbol, currentInput;
 	pseudoToken mistakenPseudoToken;
 
-	// Opens the SIM's LL(1) grammar file
-	ll1GrammarFile.open(string(PROJECT_DIRECTORY_PATH).append(string(LL1_GRAMMAR_PARTIAL_PATH)),ios::in);
-
-	// Checks if file was properly opened
-	if(ll1GrammarFile.bad())
-	{
-		handleError(GRAMMAR_FILE_OPENING_ERROR);
-		stopAnalysis = true;
-		validAnalysis = false;
-		overrideFlag = true;
-	}
-
-	// Gets the full grammar map
-	ll1GrammarMap = getll1GrammarMapFromGrammarFile(ll1GrammarFile);
-
-	// Checks if LL(1) grammar file was properly read
-	if(ll1GrammarMap.empty())
-	{
-		handleError(BAD_GRAMMAR_FILE);
-		stopAnalysis = true;
-		validAnalysis = false;
-		overrideFlag = true;
-	}
+	// Gets the full grammar map, shared by every compilation
+	const map<string,innerMap> & ll1GrammarMap = getCompilerResources().ll1GrammarMap;
 
 	// Gets the input queue
 	inputQueue = getInputQueueFromTokens(tokens);
@@ -486,11 +407,14 @@ bool syntaticalAnalyzeSIMSourceCode(vector<token> & tokens, string fileName)
 		// Checks if X is a nonterminal symbol
 		else if(isSymbolNonterminal(currentSymbol))
 		{
+			map<string,innerMap>::const_iterator rules = ll1GrammarMap.find(currentSymbol);
+			innerMap::const_iterator rule;
+
 			// Checks if there's a rule for X and t (M(X,t))
-			if(ll1GrammarMap[currentSymbol].find(currentInput) != ll1GrammarMap[currentSymbol].end())
+			if(rules != ll1GrammarMap.end() && (rule = rules->second.find(currentInput)) != rules->second.end())
 			{
 				symbolsStack.pop();
-				vector<string> ruleSymbols = getSymbolsFromRule(ll1GrammarMap[currentSymbol][currentInput]);
+				vector<string> ruleSymbols = getSymbolsFromRule(rule->second);
 				for(int symbolIndex = 0; symbolIndex < ruleSymbols.size(); symbolIndex++)
 				{
 					string symbolToPush = ruleSymbols[symbolIndex];
@@ -520,7 +444,7 @@ bool syntaticalAnalyzeSIMSourceCode(vector<token> & tokens, string fileName)
 	}
 
 	// Reports syntatical error if happened
-	if(!validAnalysis && !overrideFlag)
+	if(!validAnalysis)
 	{
 		handleError(SYNTATICAL_ERROR,(fileName + ":" + to_string(mistakenPseudoToken.lineNumber) + ": invalid syntax structure"));
 	}
@@ -692,6 +616,57 @@ int isInputValid(int argumentsCount)
 	return result;
 }
 
+// Compiler resources functions
+
+// Loads the resources shared by all compilations, only once until they are destroyed
+void initializeCompilerResources()
+{
+	ifstream ll1GrammarFile;
+	if(sharedCompilerResources.initialized)
+	{
+		return;
+	}
+
+	// Checks if project was compiled through Makefile
+	if(MAKEFILE_REQUIRED_USAGE_CRITICAL_ERROR)
+	{
+		handleError(MAKEFILE_NOT_USED_ERROR);
+	}
+
+	// Opens the SIM's LL(1) grammar file
+	ll1GrammarFile.open(string(PROJECT_DIRECTORY_PATH).append(string(LL1_GRAMMAR_PARTIAL_PATH)),ios::in);
+
+	// Checks if file was properly opened
+	if(!ll1GrammarFile.is_open())
+	{
+		handleError(GRAMMAR_FILE_OPENING_ERROR);
+	}
+
+	// Gets the full grammar map
+	sharedCompilerResources.ll1GrammarMap = getll1GrammarMapFromGrammarFile(ll1GrammarFile);
+	ll1GrammarFile.close();
+
+	// Checks if LL(1) grammar file was properly read
+	if(sharedCompilerResources.ll1GrammarMap.empty())
+	{
+		handleError(BAD_GRAMMAR_FILE);
+	}
+	sharedCompilerResources.initialized = true;
+}
+
+// Releases the resources shared by all compilations
+void destroyCompilerResources()
+{
+	sharedCompilerResources.ll1GrammarMap.clear();
+	sharedCompilerResources.initialized = false;
+}
+
+// Gets the resources shared by all compilations
+const compilerResources & getCompilerResources()
+{
+	return sharedCompilerResources;
+}
+
 // SIM file functions
 
 // Gets the SIM file path from a input
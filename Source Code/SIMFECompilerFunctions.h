@@ -20,6 +20,12 @@ bool syntaticalAnalyzeSIMSourceCode(vector<token> & tokens, string fileName);
 bool semanticalAnalyzeSIMSourceCode(vector<token> & tokens, string fileName);
 int isInputValid(int argumentsCount);
 
+// Compiler resources functions
+
+void initializeCompilerResources();
+void destroyCompilerResources();
+const compilerResources & getCompilerResources();
+
 // SIM file functions
 
 string getSIMFilePathFromInput(int argumentsCount, char ** arguments);